@@ -591,7 +591,7 @@ config.libs = [
             Object(NonMatching, "Game/AreaObj/AreaForm.cpp"),
             Object(NonMatching, "Game/AreaObj/AreaFormDrawer.cpp"),
             Object(NonMatching, "Game/AreaObj/AreaObj.cpp"),
-            Object(Matching, "Game/AreaObj/AreaObjContainer.cpp"),
+            Object(NonMatching, "Game/AreaObj/AreaObjContainer.cpp"),
             Object(Matching, "Game/AreaObj/AreaObjFollower.cpp"),
             Object(Matching, "Game/AreaObj/AstroChangeStageCube.cpp"),
             Object(Matching, "Game/AreaObj/AudioEffectArea.cpp"),
@@ -1207,7 +1207,7 @@ config.libs = [
             Object(NonMatching, "Game/LiveActor/Binder.cpp"),
             Object(NonMatching, "Game/LiveActor/ClippingActorHolder.cpp"),
             Object(NonMatching, "Game/LiveActor/ClippingActorInfo.cpp"),
-            Object(Matching, "Game/LiveActor/ClippingDirector.cpp"),
+            Object(NonMatching, "Game/LiveActor/ClippingDirector.cpp"),
             Object(NonMatching, "Game/LiveActor/ClippingGroupHolder.cpp"),
             Object(NonMatching, "Game/LiveActor/ClippingJudge.cpp"),
             Object(NonMatching, "Game/LiveActor/DisplayListMaker.cpp"),
@@ -2261,7 +2261,7 @@ config.libs = [
             Object(NonMatching, "Game/Util/GamePadUtil.cpp"),
             Object(NonMatching, "Game/Util/GravityUtil.cpp"),
             Object(NonMatching, "Game/Util/HashUtil.cpp"),
-            Object(Matching, "Game/Util/JMapUtil.cpp"),
+            Object(NonMatching, "Game/Util/JMapUtil.cpp"),
             Object(NonMatching, "Game/Util/JointUtil.cpp"),
             Object(NonMatching, "Game/Util/LayoutUtil.cpp"),
             Object(NonMatching, "Game/Util/LightUtil.cpp"),
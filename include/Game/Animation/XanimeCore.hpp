@@ -76,6 +76,18 @@ public:
     u8 _C;
 };
 
+#define XANIME_SAMPLE_CACHE_SIZE 0x400
+#define XANIME_SAMPLE_CACHE_PROBE_MAX 4
+
+// one sampled joint of a bck at one frame, shared by every instance playing the same frame
+struct XanimeSampleCacheEntry {
+    const J3DAnmTransform* mAnm;    // 0x0
+    f32 mFrame;                     // 0x4
+    u16 mJointNo;                   // 0x8
+    u16 mStamp;                     // 0xA
+    XtransformInfo mInfo;           // 0xC
+};
+
 class XanimeCore : public J3DMtxCalc {
 public:
     XanimeCore(u32, u32, u8);
@@ -96,6 +108,10 @@ public:
 
     XjointTransform* getJointTransform(u32) const;
 
+    static bool findSampleCache(const J3DAnmTransform *, f32, u16, XtransformInfo *);
+    static void entrySampleCache(const J3DAnmTransform *, f32, u16, const XtransformInfo &);
+    static void clearSampleCache();
+
     u8 _4;
     u8 mTrackCount;                     // 0x5
     u8 _6;
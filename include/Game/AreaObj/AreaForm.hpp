@@ -8,6 +8,7 @@ class AreaForm {
 public:
     virtual void init(const JMapInfoIter &);
     virtual bool isInVolume(const TVec3f &) const;
+    virtual void calcWorldBounds(TBox3f *) const;
 
     TPos3f* _4;
 };
@@ -18,6 +19,7 @@ public:
 
     virtual void init(const JMapInfoIter &);
     virtual bool isInVolume(const TVec3f &) const;
+    virtual void calcWorldBounds(TBox3f *) const;
 
     void calcWorldPos(TVec3f *) const;
     void calcWorldBox(TDirBox3f *) const;
@@ -40,6 +42,7 @@ public:
 
     virtual void init(const JMapInfoIter &);
     virtual bool isInVolume(const TVec3f &) const;
+    virtual void calcWorldBounds(TBox3f *) const;
 
     void calcUpVec(TVec3f *) const;
     void calcPos(TVec3f *) const;
@@ -55,6 +58,7 @@ public:
 
     virtual void init(const JMapInfoIter &);
     virtual bool isInVolume(const TVec3f &) const;
+    virtual void calcWorldBounds(TBox3f *) const;
 
     void calcUpVec(const TVec3f &);
 
@@ -69,6 +73,7 @@ public:
 
     virtual void init(const JMapInfoIter &);
     virtual bool isInVolume(const TVec3f &) const;
+    virtual void calcWorldBounds(TBox3f *) const;
 
     void calcPos(TVec3f *) const;
     void calcCenterPos(TVec3f *) const;
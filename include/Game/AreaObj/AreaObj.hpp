@@ -2,6 +2,7 @@
 
 #include "Game/NameObj/NameObj.hpp"
 #include "Game/Util/Array.hpp"
+#include "JSystem/JGeometry/TBox.hpp"
 #include "JSystem/JGeometry/TMatrix.hpp"
 #include "JSystem/JGeometry/TVec.hpp"
 #include <revolution.h>
@@ -55,6 +56,21 @@ public:
     StageSwitchCtrl* mSwitchCtrl; // 0x38
 };
 
+// node of the bounding volume tree AreaObjMgr::find_in walks, the left child directly follows its parent
+struct AreaObjIndexNode {
+    TBox3f mBounds;     // 0x0
+    s32 mRight;         // 0x18
+    s32 mLeafStart;     // 0x1C
+    s32 mLeafNum;       // 0x20, 0 for inner nodes
+    s32 mMinArrayIndex; // 0x24, lowest entry below this node
+};
+
+// result of one position and manager pair in AreaObjContainer::findAreaObjs, kept by the caller between frames
+struct AreaObjQueryResult {
+    AreaObj* mAreaObj;  // 0x0
+    s32 mIndex;         // 0x4, entry in the manager, -1 when outside
+};
+
 class AreaObjMgr : public NameObj {
 public:
     AreaObjMgr(s32, const char *);
@@ -63,7 +79,21 @@ public:
 
     void entry(AreaObj *);
     AreaObj* find_in(const TVec3f &) const;
+    s32 findIndex(const TVec3f &, s32) const;
+    void invalidateIndex();
+
+    void initIndex();
+    void updateIndex();
+    s32 buildIndexNode(s32, s32);
+    s32 findIndexTree(const TVec3f &, s32) const;
 
     MR::Vector<MR::AssignableArray<AreaObj*> > mArray; // 0xC
     s32 _18;
+    AreaObjIndexNode* mIndexNodes;                     // 0x1C
+    s32 mIndexNodeNum;                                 // 0x20
+    s32* mIndexLeaves;                                 // 0x24, entries in tree order
+    TBox3f* mIndexBounds;                              // 0x28, world bounds of every entry
+    s32* mFollowEntries;                               // 0x2C, entries moving with a base matrix
+    s32 mFollowEntryNum;                               // 0x30
+    bool mIsValidIndex;                                // 0x34
 };
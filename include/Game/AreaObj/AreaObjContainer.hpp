@@ -54,6 +54,7 @@ public:
 
     AreaObjMgr* getManager(const char *) const;
     AreaObj* getAreaObj(const char *, const TVec3f &) const;
+    void findAreaObjs(const char **, s32, const TVec3f *, s32, AreaObjQueryResult *) const;
 
     inline AreaObjMgr* getFirstMgr() const {
         return mManagerArray[0];
@@ -63,8 +64,13 @@ public:
         return mManagerArray[mNumManagers];
     }
 
+    AreaObjMgr* findManager(const char *) const;
+    void addManagerTable(AreaObjMgr *);
+
     AreaObjMgr* mManagerArray[0x50];    // 0xC
     u32 mNumManagers;                   // 0x14C
+    const char* mManagerTableName[0x80];// 0x150, manager names by hash
+    AreaObjMgr* mManagerTable[0x80];    // 0x350, the manager getManager returns for that name
 };
 
 namespace MR {
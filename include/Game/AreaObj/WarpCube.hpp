@@ -38,5 +38,5 @@ public:
     void startEventCamera(const AreaObj *);
     void endEventCamera();
 
-    const WarpCube* mWarpCube;      // 0x1C
+    const WarpCube* mWarpCube;      // 0x38
 };
\ No newline at end of file
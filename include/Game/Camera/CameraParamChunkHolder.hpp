@@ -21,6 +21,8 @@ public:
     CameraParamChunk *findChunk(s32, const char *);
     void loadFile(s32);
     void arrangeChunk(CameraParamChunk *);
+    void addChunkTable(CameraParamChunk *);
+    CameraParamChunk *findChunkTable(s32, const char *) const;
 
     CameraHolder *mCameraHolder;    // 0xC
     u32 mChunkCapacity;             // 0x10
@@ -29,4 +31,5 @@ public:
     u32 mCameraVersion;             // 0x1C
     u8 mIsSorted;                   // 0x20
     u8 _21[3];
+    CameraParamChunk **mChunkTable; // 0x24, chunks by hash of zone and name
 };
\ No newline at end of file
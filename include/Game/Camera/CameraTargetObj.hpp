@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Game/AreaObj/AreaObj.hpp"
 #include "Game/NameObj/NameObj.hpp"
 #include "JSystem/JGeometry.hpp"
 
@@ -77,6 +78,7 @@ public:
     TVec3f mFront;                  // 0x20
     TVec3f mSide;                   // 0x2C
     CubeCameraArea *mCameraArea;    // 0x38
+    AreaObjQueryResult mCameraAreaQuery; // 0x3C
 };
 
 class CameraTargetPlayer : public CameraTargetObj {
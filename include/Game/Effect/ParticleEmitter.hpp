@@ -16,4 +16,5 @@ public:
     JPAEmitterManager* mManager;    // 0x0
     bool mPaused;                   // 0x4
     bool mStopped;                  // 0x5 Not sure if it is stopped, but good chance it is.
+    u16 mNextFree;                  // 0x6 ParticleEmitterHolder's free list link, set up by the holder
 };
\ No newline at end of file
@@ -5,11 +5,28 @@
 
 class EffectSystem;
 
+// free list and counters of the emitter pool. EffectSystem allocates the holder at 0x10 bytes, so these
+// live in the slots mEmitters has past mNumEmitters
+struct ParticleEmitterPool {
+    u16 mFreeHead;      // 0x0
+    s32 mCreateNum;     // 0x4
+    s32 mCreateNumMax;  // 0x8
+    u32 mPoolHitNum;    // 0xC
+    u32 mPoolMissNum;   // 0x10
+    u32 mCullNum;       // 0x14
+};
+
 class ParticleEmitterHolder {
 public:
     ParticleEmitterHolder(EffectSystem const *, int);
 
+    ParticleEmitter* getUnusedParticleEmitter(bool);
+    void releaseParticleEmitter(ParticleEmitter *);
+    void resetCreateCount();
+    void setCreateNumMax(s32);
+    ParticleEmitterPool* getPool() const;
+
     EffectSystem const* mEffectSystem;              // 0x0
     MR::AssignableArray<ParticleEmitter> mEmitters; // 0x4
-    int mNumEmitters;                               // 0x8
-};
\ No newline at end of file
+    int mNumEmitters;                               // 0xC
+};
@@ -35,7 +35,7 @@ public:
     int _28;
     HitInfo *_2C;
     TVec3f _30;
-    HitInfo _3C;
+    HitInfo mFloorInfo;                 // 0x3C
     f32 _C8;
     HitInfo _CC;
     f32 _158;
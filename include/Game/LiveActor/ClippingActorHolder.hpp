@@ -5,10 +5,6 @@
 #include "Game/LiveActor/LodCtrl.hpp"
 #include "Game/LiveActor/ViewGroupCtrl.hpp"
 
-namespace {
-    static int sActorNumMax;
-};
-
 class ClippingActorHolder : public NameObj {
 public:
     ClippingActorHolder();
@@ -28,6 +24,7 @@ public:
     void setTypeToSphere(LiveActor *, f32, const TVec3f *);
     void setFarClipLevel(LiveActor *, s32);
     ClippingActorInfo* find(const LiveActor *) const;
+    void addToInfoTable(ClippingActorInfo *);
 
     u32 _C;
     ClippingActorInfoList* _10;
@@ -35,4 +32,7 @@ public:
     ClippingActorInfoList* _18;
     ClippingActorInfoList* _1C;
     ViewGroupCtrl* mViewGroupCtrl;  // 0x20
+    ClippingActorInfo** mInfoTable; // 0x24
+    u32 mInfoTableMask;             // 0x28
+    LodCtrlHolder* mLodCtrlHolder;  // 0x2C
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 class ViewGroupCtrlDataEntry;
 class LiveActor;
+class ClippingActorInfoList;
+class ClippingJudge;
 
 class ClippingActorInfo {
 public:
@@ -12,6 +14,8 @@ public:
 
     void judgeClipping();
     bool isJudgedToClip() const;
+    bool isJudgedToClipCoherence(const ClippingJudge *);
+    s32 getFarClipLevel() const;
     bool isGroupClipping() const;
     void setTypeToSphere(f32, const TVec3f *);
     void setGroupClippingNo(const JMapInfoIter &);
@@ -23,6 +27,15 @@ public:
     s16 mFarClipLevel;  // 0x10
     s16 _12;
     ViewGroupCtrlDataEntry* _14;
+    ClippingActorInfoList* mList;   // 0x18
+    s32 mListIndex;                 // 0x1C
+    TVec3f mJudgedPos;              // 0x20
+    f32 mJudgedMargin;              // 0x2C
+    f32 mJudgedCameraDist;          // 0x30
+    f32 mCameraMoveSum;             // 0x34
+    f32 mCameraTurnSum;             // 0x38
+    s16 mJudgedFarClipLevel;        // 0x3C
+    bool mIsJudgedClip;             // 0x3E
 };
 
 class ClippingActorInfoList {
@@ -35,6 +48,7 @@ public:
     bool isInList(const LiveActor *) const;
 
     ClippingActorInfo* remove(LiveActor *);
+    void remove(ClippingActorInfo *);
 
     int _0;
     s32 _4;
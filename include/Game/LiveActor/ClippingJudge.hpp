@@ -14,13 +14,23 @@ public:
 
     bool isJudgedToClipFrustum(const TVec3f &, f32) const;
     bool isJudgedToClipFrustum(const TVec3f &, f32, s32) const;
+    bool isJudgedToClipFrustumWithMargin(const TVec3f &, f32, s32, f32 *) const;
     void calcViewingVolume(THex3f *, f32);
+    void calcCameraMotion();
 
     THex3f mFrustum;             // 0xC
     THex3f mClipFrustums[0x8];
     f32  mClipDistances[0x8];
+    bool mIsCoherenceMode;
+    bool mIsValidPrevFrustum;
+    THex3f mPrevFrustum;
+    TVec3f mCameraPos;
+    f32 mCameraMove;            // upper bound of plane offset change this frame
+    f32 mCameraTurn;            // upper bound of plane normal change this frame
 };
 
 namespace MR {
     ClippingJudge* getClippingJudge();
+    void validateClippingCoherence();
+    void invalidateClippingCoherence();
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Game/LiveActor/ModelObj.hpp"
 #include "Game/Util.hpp"
+#include "Game/Util/Array.hpp"
 #include <revolution.h>
 
 class LiveActor;
@@ -36,6 +37,11 @@ public:
     void syncJointAnimation();
     void initLightCtrl();
     ModelObj* initLodModel(int, int, int, bool) const;
+    s32 getLodLevel() const;
+    s32 calcLodLevel(f32, f32) const;
+    s32 calcRequestedLevel(f32);
+    bool isExpensiveToShow(s32) const;
+    void showLodModel(s32);
 
     f32 _0;
     f32 _4;
@@ -53,6 +59,24 @@ public:
     const bool* _28;
     s16 mViewGroupID;                   // 0x2C
     ActorLightCtrl* mActorLightCtrl;    // 0x30
+    f32 mDistanceToCamera;              // 0x34
+    s32 mRequestedLevel;                // 0x38
+    bool mIsRequestedUpdate;            // 0x3C
+    bool mIsEntryHolder;                // 0x3D
+};
+
+// switches the models of every requested LodCtrl in one pass, nearest first
+class LodCtrlHolder {
+public:
+    LodCtrlHolder(s32);
+
+    void registerLodCtrl(LodCtrl *);
+    void update();
+
+    MR::Vector<MR::AssignableArray<LodCtrl*> > mLodCtrls;      // 0x0
+    MR::Vector<MR::AssignableArray<LodCtrl*> > mSwitchCtrls;   // 0xC
+    f32 mHysteresisRate;                                        // 0x18
+    s32 mExpensiveSwitchMax;                                    // 0x1C
 };
 
 class LodCtrlFunction {
@@ -5,6 +5,7 @@
 class BckCtrl;
 class BrkCtrl;
 class DisplayListMaker;
+class JKRHeap;
 class ResourceHolder;
 class XanimePlayer;
 class XanimeResourceTable;
@@ -20,6 +21,8 @@ public:
     void calcView();
     void entry();
     void newDifferedDLBuffer();
+    void requestDifferedDLBuffer();
+    void tryNewDifferedDLBuffer();
     void updateDL(bool);
     void startBck(const char *, const char *);
     void startBckWithInterpole(const char *, s32);
@@ -71,4 +74,5 @@ public:
     J3DModel* mModel;                       // 0x1C
     ResourceHolder* mModelResourceHolder;   // 0x20
     DisplayListMaker* mDisplayListMaker;    // 0x24
+    JKRHeap* mDifferedDLHeap;               // 0x28
 };
\ No newline at end of file
@@ -11,6 +11,17 @@ class ShadowDrawer;
 
 class ShadowController;
 
+// the power of two above the holder's 0x500 controllers, so probes stay short
+#define SHADOW_DROP_CACHE_SIZE 0x800
+
+// where a controller last dropped its shadow, so a host at rest can skip the ray and gravity queries
+struct ShadowDropCache {
+    const ShadowController* mController;    // 0x0
+    TVec3f mDropPos;                        // 0x4
+    TVec3f mDropDir;                        // 0x10
+    u32 mAge;                               // 0x1C
+};
+
 class ShadowControllerList {
 public:
     ShadowControllerList(LiveActor *, u32);
@@ -35,11 +46,15 @@ public:
     virtual void movement();
 
     void updateController();
+    ShadowDropCache* findDropCache(const ShadowController *);
+    bool isReuseDropCache(const ShadowController *, ShadowDropCache *) const;
+    void updateDropCache(const ShadowController *, ShadowDropCache *);
 
     MR::Vector<MR::AssignableArray<ShadowController*> > _C;
     MR::Vector<MR::AssignableArray<ShadowController*> > _18;
     bool _24;
     f32 mFarClip;                                                   // 0x28
+    ShadowDropCache* mDropCache;                                    // 0x2C
 };
 
 class ShadowController {
@@ -3,6 +3,8 @@
 #include "Game/Util.hpp"
 #include "JSystem/JGeometry/TVec.hpp"
 
+#define BEZIER_RAIL_PART_TABLE_NUM 16
+
 class RailPart;
 
 namespace {
@@ -17,8 +19,11 @@ public:
     void calcPos(TVec3f *, f32) const;
     void calcVelocity(TVec3f *, f32) const;
 
-    f32 getLength(f32, f32, int);
+    f32 getLength(f32, f32, int) const;
     f32 getParam(f32) const;
+    f32 getCoord(f32) const;
+    void initArcLengthTable();
+    void calcBounds(TVec3f *, TVec3f *) const;
 
     f32 getNearestParam(const TVec3f &, f32) const;
 
@@ -27,6 +32,7 @@ public:
     TVec3f _18;
     TVec3f _24;
     f32 mLength; // 0x30 
+    f32 mArcLengths[BEZIER_RAIL_PART_TABLE_NUM + 1]; // 0x34, coord at evenly spaced params
 };
 
 class BezierRail {
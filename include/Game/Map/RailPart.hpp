@@ -17,10 +17,14 @@ public:
     f32 getLength(f32, f32, int) const;
     f32 getTotalLength() const;
     f32 getParam(f32) const;
+    f32 getCoord(f32) const;
     f32 getNearestParam(const TVec3f &, f32) const;
+    f32 calcBoundsDistanceSquared(const TVec3f &) const;
 
     LinearRailPart* mRailPartLinear; // 0x0
     BezierRailPart* mRailPartBezier; // 0x4
+    TVec3f mBoundsMin;               // 0x8
+    TVec3f mBoundsMax;               // 0x14
 };
 
 class LinearRailPart {
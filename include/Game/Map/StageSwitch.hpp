@@ -6,6 +6,8 @@
 #include "Game/Util/Array.hpp"
 #include "Game/Util/JMapIdInfo.hpp"
 
+#define STAGE_SWITCH_ZONE_TABLE_SIZE 0x20
+
 class BitFlag128 {
 public:
     inline BitFlag128() {
@@ -34,6 +36,7 @@ public:
 
     JMapIdInfo* mIDInfo;    // 0x0
     bool mIsGlobal;         // 0x4
+    ZoneSwitch* mSwitch;    // 0x8, resolved by StageSwitchFunction::createSwitchIdInfo
 };
 
 class StageSwitchContainer : public NameObj {
@@ -54,6 +57,7 @@ public:
 private:
     MR::Vector<MR::FixedArray<ContainerSwitch, 20> > mSwitches; // 0x0C
     ZoneSwitch* mGlobalSwitches;                                // 0xB0
+    ZoneSwitch* mZoneSwitchTable[STAGE_SWITCH_ZONE_TABLE_SIZE]; // 0xB4, by zone ID
 };
 
 class StageSwitchFunction {
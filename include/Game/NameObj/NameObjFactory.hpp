@@ -40,6 +40,7 @@ public:
     static void requestMountObjectArchives(const char *, const JMapInfoIter &);
     static bool isReadResourceFromDVD(const char *, const JMapInfoIter &);
     static const Name2CreateFunc* getName2CreateFunc(const char *, const Name2CreateFunc *);
+    static void initCreateFuncIndex();
     static void getMountObjectArchiveList(NameObjArchiveListCollector *, const char *, const JMapInfoIter &);
     static bool isPlayerArchiveLoaderObj(const char *);
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Game/AreaObj/AreaObj.hpp"
 #include "Game/Map/WaterInfo.hpp"
 #include "Game/Player/Mario.hpp"
 #include "Game/Player/MarioConst.hpp"
@@ -173,4 +174,5 @@ public:
     u8 _1B2;
     f32 _1B4;
     f32 _1B8;
+    AreaObjQueryResult mWaterAreaQuery; // 0x1BC
 };
@@ -11,6 +11,7 @@ public:
     JKRMemArchive* mArchive;        // 0x0
     JKRHeap* mHeap;                 // 0x4
     char* mArchiveName;             // 0x8
+    const char* mNameHandle;        // 0xC, MR::internString of the name
 };
 
 class ArchiveHolder {
@@ -30,6 +31,7 @@ public:
     void getArchiveAndHeap(const char *, JKRArchive **, JKRHeap **) const;
     void removeIfIsEqualHeap(JKRHeap *);
     ArchiveHolderArchiveEntry* findEntry(const char *) const;
+    void resetNameHandles();
 
     ArchiveHolderArchiveEntry** mEntries;           // 0x0
     s32 mMaxEntries;                                // 0x4
@@ -11,6 +11,7 @@ public:
     DrawBufferExecuter(const char *, J3DModel *, s32);
 
     void add(LiveActor *);
+    void remove(LiveActor *);
 
     void findLightInfo(LiveActor *);
     void onExecuteLight(s32);
@@ -24,4 +25,5 @@ public:
     u32 _10;
     u32 _14;
     u32 mDrawBufferCount; // 0x18
+    u32 mStateSortKey;    // 0x1C
 };
\ No newline at end of file
@@ -13,17 +13,22 @@ public:
     s32 registerDrawBuffer(LiveActor *);
     
     void active(LiveActor *, s32);
+    void deactive(LiveActor *, s32);
 
     void findLightInfo(LiveActor *, s32);
+    void sortActiveExecuter();
     void entry();
 
     void setDrawCameraType(s32);
     void setLightType(s32);
     s32 findExecuterIndex(const char *) const;
+    void addExecuterIndex(const char *, s32);
 
     MR::Vector<MR::AssignableArray<DrawBufferExecuter *> > _0;
     MR::Vector<MR::AssignableArray<DrawBufferExecuter *> > _C;
     s32 mCount;                                                 // 0x18
     s32 _1C;                                                    // 0x1C
     s32 _20;                                                    // 0x20
+    bool mIsSortedActive;                                       // 0x24
+    bool mIsOpaque;                                             // 0x25, no executer has a blending material
 };
\ No newline at end of file
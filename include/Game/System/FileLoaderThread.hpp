@@ -9,6 +9,7 @@ struct RequestFileInfo {
     char mFileName[0x80];                  // 0x8
     u32 _88;
     FileHolderFileEntry* mFileEntry;        // 0x8C
+    const char* mNameHandle;                // 0x90, MR::internString of the name
 };
 
 class FileLoaderThread : public OSThreadWrapper {
@@ -6,6 +6,7 @@
 class AreaObj;
 class AreaObjContainer;
 class AreaObjMgr;
+struct AreaObjQueryResult;
 class AreaCubeBoundingBox;
 class WaterInfo;
 
@@ -13,6 +14,9 @@ namespace MR {
     AreaObjMgr* getAreaObjManager(const char *);
     AreaObj* getAreaObj(const char *, const TVec3f &);
     bool isInAreaObj(const char *, const TVec3f &);
+    void initAreaObjQueryResult(AreaObjQueryResult *, s32);
+    void findAreaObjs(const char **, s32, const TVec3f *, s32, AreaObjQueryResult *);
+    AreaObj* findAreaObj(const char *, const TVec3f &, AreaObjQueryResult *);
     s32 getAreaObjArg(const AreaObj *, s32);
 
     void calcCylinderPos(TVec3f *, const AreaObj *);
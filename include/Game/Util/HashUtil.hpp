@@ -24,7 +24,61 @@ public:
     u32 _18;
 };
 
+/// @brief Linear probe sequence over a power of two sized open addressed table.
+class HashProbe {
+public:
+    /// @brief Starts at the slot of the given hash.
+    /// @param hash The hash code of the key.
+    /// @param tableSize The number of slots, a power of two.
+    /// @param probeMax The number of slots visited at most.
+    HashProbe(u32 hash, u32 tableSize, u32 probeMax) {
+        mMask = tableSize - 1;
+        mSlot = hash & mMask;
+        mRest = probeMax - 1;
+    }
+
+    /// @brief Returns the current slot.
+    /// @return The current slot.
+    u32 getSlot() const {
+        return mSlot;
+    }
+
+    /// @brief Steps to the following slot.
+    /// @return False once the probe limit is reached.
+    bool next() {
+        if (mRest == 0) {
+            return false;
+        }
+
+        mRest--;
+        mSlot = (mSlot + 1) & mMask;
+        return true;
+    }
+
+    u32 mSlot;  // 0x0
+    u32 mMask;  // 0x4
+    u32 mRest;  // 0x8
+};
+
 namespace MR {
     u32 getHashCode(const char *);
     u32 getHashCodeLower(const char *);
+    const char* internString(const char *);
+    const char* findInternedString(const char *);
+    void clearInternedStrings();
+
+    /// @brief Spreads a key over the slots of a HashProbe table.
+    /// @param key The key, sequential keys are fine.
+    /// @return The mixed hash code.
+    inline u32 getMixedHashCode(u32 key) {
+        u32 hash = key * 0x9E3779B1;
+        return hash ^ (hash >> 16);
+    }
+
+    /// @brief Spreads an object address over the slots of a HashProbe table.
+    /// @param pPtr The address.
+    /// @return The mixed hash code.
+    inline u32 getPointerHashCode(const void *pPtr) {
+        return getMixedHashCode(reinterpret_cast<u32>(pPtr) >> 2);
+    }
 };
\ No newline at end of file
@@ -12,6 +12,36 @@
 #define JMAP_VALUE_TYPE_STRING_PTR 6
 #define JMAP_VALUE_TYPE_NULL 7
 
+// JGadget::getHashCode of frequently read field names, so hot getters skip hashing the key
+#define JMAP_HASH_OBJ_ARG0 0x08E9C302
+#define JMAP_HASH_OBJ_ARG1 0x08E9C303
+#define JMAP_HASH_OBJ_ARG2 0x08E9C304
+#define JMAP_HASH_OBJ_ARG3 0x08E9C305
+#define JMAP_HASH_OBJ_ARG4 0x08E9C306
+#define JMAP_HASH_OBJ_ARG5 0x08E9C307
+#define JMAP_HASH_OBJ_ARG6 0x08E9C308
+#define JMAP_HASH_OBJ_ARG7 0x08E9C309
+#define JMAP_HASH_POS_X 0x065E794D
+#define JMAP_HASH_POS_Y 0x065E794E
+#define JMAP_HASH_POS_Z 0x065E794F
+#define JMAP_HASH_DIR_X 0x05B2A146
+#define JMAP_HASH_DIR_Y 0x05B2A147
+#define JMAP_HASH_DIR_Z 0x05B2A148
+#define JMAP_HASH_SCALE_X 0x71E5EAC3
+#define JMAP_HASH_SCALE_Y 0x71E5EAC4
+#define JMAP_HASH_SCALE_Z 0x71E5EAC5
+#define JMAP_HASH_SW_A 0x00270D26
+#define JMAP_HASH_SW_B 0x00270D27
+#define JMAP_HASH_SW_APPEAR 0x749DFBD0
+#define JMAP_HASH_SW_DEAD 0xC075815F
+#define JMAP_HASH_SW_SLEEP 0x4F11491C
+#define JMAP_HASH_L_ID 0x003289CE
+#define JMAP_HASH_NAME 0x00337A8B
+#define JMAP_HASH_COMMON_PATH_ID 0x4B700AEA
+
+#define JMAP_ITEM_SLOT_NUM 0x20
+
+class JKRHeap;
 class JMapInfoIter;
 
 struct JMapItem {
@@ -30,6 +60,24 @@ struct JMapData {
     const JMapItem mItems[];   // 0x10
 };
 
+// one field of a table expanded by JMapInfo::createDecodedView
+struct JMapDecodedColumn {
+    const u32* mValues; // 0x0, s32, u32 or const char* per entry
+    bool mIsDecoded;    // 0x4
+    bool mIsValidS32;   // 0x5, values are sign extended and readable as s32
+};
+
+// entries of one field chained by value, built by JMapInfo::getValueIndex
+struct JMapValueIndex {
+    JMapValueIndex* mNext; // 0x0
+    s32 mItemIndex;        // 0x4
+    u32 mBucketMask;       // 0x8
+    s32* mBuckets;         // 0xC, lowest entry of each bucket, -1 if empty
+    s32* mEntryNext;       // 0x10, following entry in the same bucket, -1 at the end
+};
+
+#define JMAP_VALUE_INDEX_ENTRY_MIN 16
+
 template<typename T>
 inline bool compareValues(const T a, const T b) {
     return a == b;
@@ -49,9 +97,19 @@ public:
     JMapInfo();
     ~JMapInfo();
 
+    inline JMapInfo(const JMapInfo &rInfo) {
+        *this = rInfo;
+    }
+
     inline JMapInfo& operator=(const JMapInfo &rInfo) {
         mData = rInfo.mData;
         mName = rInfo.mName;
+        memcpy(mItemSlots, rInfo.mItemSlots, sizeof(mItemSlots));
+        // the decoded view belongs to the info that created it
+        mDecodedColumns = nullptr;
+        mDecodedSize = 0;
+        mValueIndexList = rInfo.mValueIndexList;
+        mValueIndexHeap = rInfo.mValueIndexHeap;
         return *this;
     }
 
@@ -75,6 +133,80 @@ public:
     void setName(const char*);
     const char* getName() const;
     s32 searchItemInfo(const char*) const;
+    s32 searchItemInfoByHash(u32) const;
+    void createItemSlotTable();
+    u32 createDecodedView();
+
+    inline const JMapDecodedColumn* getDecodedColumn(int itemIndex) const {
+        if (mDecodedColumns == nullptr || !mDecodedColumns[itemIndex].mIsDecoded) {
+            return nullptr;
+        }
+
+        return &mDecodedColumns[itemIndex];
+    }
+
+    inline u32 getDecodedViewSize() const {
+        return mDecodedSize;
+    }
+
+    static u32 getDecodedViewTotalSize();
+    void destroyDecodedView();
+
+    const JMapValueIndex* getValueIndex(int) const;
+    s32 getFirstIndexedEntry(const JMapValueIndex*, u32, int) const;
+
+    static inline bool isIntegerItem(const JMapItem* pItem) {
+        return pItem->mType == JMAP_VALUE_TYPE_LONG || pItem->mType == JMAP_VALUE_TYPE_LONG_2
+            || pItem->mType == JMAP_VALUE_TYPE_SHORT || pItem->mType == JMAP_VALUE_TYPE_BYTE;
+    }
+
+    static inline bool isValidS32Item(const JMapItem* pItem) {
+        if (pItem->mShift != 0) {
+            return false;
+        }
+
+        switch (pItem->mType) {
+            case JMAP_VALUE_TYPE_LONG:
+                return pItem->mMask == 0xffffffff;
+            case JMAP_VALUE_TYPE_SHORT:
+                return pItem->mMask == 0xffff;
+            case JMAP_VALUE_TYPE_BYTE:
+                return pItem->mMask == 0xff;
+            default:
+                return false;
+        }
+    }
+
+    // integers are keyed by their u32 reading, strings ignore case so MR::findJMapInfoElementNoCase can share the index
+    static inline bool calcValueIndexKey(const JMapItem* pItem, s32 value, u32* pKeyOut) {
+        if (!isValidS32Item(pItem)) {
+            return false;
+        }
+
+        *pKeyOut = static_cast<u32>(value) & pItem->mMask;
+        return true;
+    }
+
+    static inline bool calcValueIndexKey(const JMapItem* pItem, u32 value, u32* pKeyOut) {
+        if (!isIntegerItem(pItem)) {
+            return false;
+        }
+
+        *pKeyOut = value;
+        return true;
+    }
+
+    static inline bool calcValueIndexKey(const JMapItem* pItem, f32 value, u32* pKeyOut) {
+        if (pItem->mType != JMAP_VALUE_TYPE_FLOAT) {
+            return false;
+        }
+
+        // 0.0f and -0.0f compare equal
+        *pKeyOut = value == 0.0f ? 0 : *reinterpret_cast<const u32*>(&value);
+        return true;
+    }
+
+    static bool calcValueIndexKey(const JMapItem*, const char*, u32*);
     s32 getValueType(const char*) const;
     bool getValueFast(int, int, const char**) const;
     bool getValueFast(int, int, u32*) const;
@@ -98,10 +230,27 @@ public:
 
     template<typename T>
     JMapInfoIter findElement(const char* pKey, T searchValue, int startIndex) const NO_INLINE {
+        s32 itemIndex = searchItemInfo(pKey);
+        if (itemIndex < 0) {
+            return end();
+        }
         int entryIndex = startIndex;
         T value;
+
+        const JMapValueIndex* pIndex = getValueIndex(itemIndex);
+        u32 key;
+        if (pIndex != nullptr && calcValueIndexKey(&mData->mItems[itemIndex], searchValue, &key)) {
+            for (entryIndex = getFirstIndexedEntry(pIndex, key, startIndex); entryIndex >= 0; entryIndex = pIndex->mEntryNext[entryIndex]) {
+                getValueFast(entryIndex, itemIndex, &value);
+                if (compareValues<T>(value, searchValue)) {
+                    return JMapInfoIter(this, entryIndex);
+                }
+            }
+            return end();
+        }
+
         while (entryIndex < getNumEntries()) {
-            getValue<T>(entryIndex, pKey, &value);
+            getValueFast(entryIndex, itemIndex, &value);
             if (compareValues<T>(value, searchValue)) {
                 return JMapInfoIter(this, entryIndex);
             }
@@ -114,6 +263,13 @@ public:
 
     const JMapData* mData; // 0x0
     const char* mName; // 0x4
+    u8 mItemSlots[JMAP_ITEM_SLOT_NUM]; // 0x8, item index + 1 by the low bits of the hash
+    JMapDecodedColumn* mDecodedColumns; // 0x28
+    u32 mDecodedSize; // 0x2C
+    mutable JMapValueIndex* mValueIndexList; // 0x30
+    JKRHeap* mValueIndexHeap; // 0x34, the heap holding the table, value indices and the decoded view go there
+
+    static u32 sDecodedViewTotalSize;
 };
 
 class JMapInfoIter {
@@ -155,6 +311,15 @@ public:
         return info->getValueFast(entryIndex, itemIndex, pValueOut);
     }
 
+    template<typename T>
+    bool getValueByHash(u32 hash, T* pValueOut) const {
+        s32 itemIndex = mInfo->searchItemInfoByHash(hash);
+        if (itemIndex < 0) {
+            return false;
+        }
+        return mInfo->getValueFast(mIndex, itemIndex, pValueOut);
+    }
+
     const JMapInfo* mInfo; // 0x0
     s32 mIndex; // 0x4
 };
@@ -269,6 +269,7 @@ namespace MR {
     ProjmapEffectMtxSetter* initDLMakerProjmapEffectMtxSetter(LiveActor*);
 
     void newDifferedDLBuffer(LiveActor*);
+    void requestDifferedDLBuffer(LiveActor*);
 
     ModelObj* createModelObjMapObj(const char*, const char*, MtxPtr);
     ModelObj* createModelObjMapObjStrongLight(const char*, const char*, MtxPtr);
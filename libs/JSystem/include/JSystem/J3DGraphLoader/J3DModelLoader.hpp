@@ -3,6 +3,8 @@
 #include <revolution.h>
 
 class J3DModelData;
+class JKRHeap;
+class JKRSolidHeap;
 class J3DMaterialTable;
 class J3DModelHierarchy;
 
@@ -228,4 +230,5 @@ public:
 class J3DModelLoaderDataBase {
 public:
     static J3DModelData* load(void const *, u32);
+    static J3DModelData* loadSolid(void const *, u32, JKRHeap *, JKRSolidHeap **);
 };
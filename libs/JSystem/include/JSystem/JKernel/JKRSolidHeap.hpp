@@ -7,8 +7,8 @@ public:
 
     static JKRSolidHeap* create(u32, JKRHeap *, bool);
 
-    u32 _6C;
-    u32 _70;
-    u32 _74;
+    u32 mFreeSize;                      // 0x6C
+    u8* mSolidHead;                     // 0x70
+    u8* mSolidTail;                     // 0x74
     u32 _78;
 };
\ No newline at end of file
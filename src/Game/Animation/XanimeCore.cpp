@@ -1,4 +1,23 @@
 #include "Game/Animation/XanimeCore.hpp"
+#include "Game/Util/HashUtil.hpp"
+
+namespace {
+    XanimeSampleCacheEntry sSampleCache[XANIME_SAMPLE_CACHE_SIZE];
+    // entries from an older stamp are empty, so clearing never touches the table
+    u16 sSampleCacheStamp = 1;
+
+    u32 calcSampleCacheHashCode(const J3DAnmTransform *pAnm, f32 frame, u16 jointNo) {
+        return MR::getPointerHashCode(pAnm) ^ MR::getMixedHashCode((static_cast<u32>(frame * 16.0f) << 8) ^ jointNo);
+    }
+
+    void setSampleCacheEntry(XanimeSampleCacheEntry *pEntry, const J3DAnmTransform *pAnm, f32 frame, u16 jointNo, const XtransformInfo &rInfo) {
+        pEntry->mAnm = pAnm;
+        pEntry->mFrame = frame;
+        pEntry->mJointNo = jointNo;
+        pEntry->mStamp = sSampleCacheStamp;
+        pEntry->mInfo = rInfo;
+    }
+};
 
 void XanimeTrack::init() {
     _0 = 0;
@@ -89,4 +108,70 @@ XtransformInfo::XtransformInfo() {
     _1C = 0.0f;
     _18 = 0.0f;
     _24 = 1.0f;
-}
\ No newline at end of file
+}
+
+XtransformInfo& XtransformInfo::operator=(const XtransformInfo &rOther) {
+    _0.set(rOther._0);
+    _C.set(rOther._C);
+    _18 = rOther._18;
+    _1C = rOther._1C;
+    _20 = rOther._20;
+    _24 = rOther._24;
+    return *this;
+}
+
+// returns false when no instance sampled this joint at this frame yet, the caller then evaluates the keys itself
+// meant for XanimeCore::calc, which is not decompiled yet
+bool XanimeCore::findSampleCache(const J3DAnmTransform *pAnm, f32 frame, u16 jointNo, XtransformInfo *pInfo) {
+    HashProbe probe(calcSampleCacheHashCode(pAnm, frame, jointNo), XANIME_SAMPLE_CACHE_SIZE, XANIME_SAMPLE_CACHE_PROBE_MAX);
+
+    do {
+        const XanimeSampleCacheEntry* pEntry = &sSampleCache[probe.getSlot()];
+
+        if (pEntry->mStamp != sSampleCacheStamp) {
+            return false;
+        }
+
+        if (pEntry->mAnm == pAnm && pEntry->mFrame == frame && pEntry->mJointNo == jointNo) {
+            *pInfo = pEntry->mInfo;
+            return true;
+        }
+    } while (probe.next());
+
+    return false;
+}
+
+// samples stay valid across frames while their scene lives, so the table fills up over time. a full probe
+// run then replaces the sample in the home slot, which keeps the newest frames cached and every chain intact
+void XanimeCore::entrySampleCache(const J3DAnmTransform *pAnm, f32 frame, u16 jointNo, const XtransformInfo &rInfo) {
+    HashProbe probe(calcSampleCacheHashCode(pAnm, frame, jointNo), XANIME_SAMPLE_CACHE_SIZE, XANIME_SAMPLE_CACHE_PROBE_MAX);
+    XanimeSampleCacheEntry* pHomeEntry = &sSampleCache[probe.getSlot()];
+
+    do {
+        XanimeSampleCacheEntry* pEntry = &sSampleCache[probe.getSlot()];
+
+        if (pEntry->mStamp != sSampleCacheStamp) {
+            setSampleCacheEntry(pEntry, pAnm, frame, jointNo, rInfo);
+            return;
+        }
+
+        if (pEntry->mAnm == pAnm && pEntry->mFrame == frame && pEntry->mJointNo == jointNo) {
+            return;
+        }
+    } while (probe.next());
+
+    setSampleCacheEntry(pHomeEntry, pAnm, frame, jointNo, rInfo);
+}
+
+// bck resources are freed with their scene, so the samples must not outlive it
+void XanimeCore::clearSampleCache() {
+    sSampleCacheStamp++;
+
+    if (sSampleCacheStamp == 0) {
+        for (s32 i = 0; i < XANIME_SAMPLE_CACHE_SIZE; i++) {
+            sSampleCache[i].mStamp = 0;
+        }
+
+        sSampleCacheStamp = 1;
+    }
+}
@@ -1,6 +1,7 @@
 #include "Game/AreaObj/AreaForm.hpp"
 #include "JSystem/JMath/JMath.hpp"
 #include "Game/Util.hpp"
+#include "math_types.hpp"
 
 template<>
 void TRot3f::mult33(const TVec3f &rSrc, TVec3f &rDst) const {
@@ -21,6 +22,28 @@ void TRot3f::mult33(const TVec3f &rSrc, TVec3f &rDst) const {
     rDst.z = rSrc.z * a33 + (rSrc.x * a31 + rSrc.y * a32);
 }
 
+namespace {
+    void extendBounds(TBox3f *pBox, const TVec3f &rPos) {
+        pBox->mMin.x = rPos.x < pBox->mMin.x ? rPos.x : pBox->mMin.x;
+        pBox->mMin.y = rPos.y < pBox->mMin.y ? rPos.y : pBox->mMin.y;
+        pBox->mMin.z = rPos.z < pBox->mMin.z ? rPos.z : pBox->mMin.z;
+        pBox->mMax.x = rPos.x > pBox->mMax.x ? rPos.x : pBox->mMax.x;
+        pBox->mMax.y = rPos.y > pBox->mMax.y ? rPos.y : pBox->mMax.y;
+        pBox->mMax.z = rPos.z > pBox->mMax.z ? rPos.z : pBox->mMax.z;
+    }
+
+    void setBoundsSphere(TBox3f *pBox, const TVec3f &rCenter, f32 radius) {
+        pBox->mMin.set<f32>(rCenter.x - radius, rCenter.y - radius, rCenter.z - radius);
+        pBox->mMax.set<f32>(rCenter.x + radius, rCenter.y + radius, rCenter.z + radius);
+    }
+};
+
+// forms without their own bounds are never culled
+void AreaForm::calcWorldBounds(TBox3f *pBox) const {
+    pBox->mMin.set<f32>(-FLOAT_MAX, -FLOAT_MAX, -FLOAT_MAX);
+    pBox->mMax.set<f32>(FLOAT_MAX, FLOAT_MAX, FLOAT_MAX);
+}
+
 AreaFormCube::AreaFormCube(int a1) {
     _4 = 0;
     _8 = a1;
@@ -63,6 +86,27 @@ bool AreaFormCube::isInVolume(const TVec3f &rPos) const {
         && transpose.z < mBounding.mMax.z;
 }
 
+void AreaFormCube::calcWorldBounds(TBox3f *pBox) const {
+    TPos3f pos;
+    calcWorldMtx(&pos);
+
+    for (s32 i = 0; i < 8; i++) {
+        TVec3f corner;
+        corner.x = (i & 1) ? mBounding.mMax.x : mBounding.mMin.x;
+        corner.y = (i & 2) ? mBounding.mMax.y : mBounding.mMin.y;
+        corner.z = (i & 4) ? mBounding.mMax.z : mBounding.mMin.z;
+        pos.mult(corner, corner);
+
+        if (i == 0) {
+            pBox->mMin.set<f32>(corner);
+            pBox->mMax.set<f32>(corner);
+        }
+        else {
+            extendBounds(pBox, corner);
+        }
+    }
+}
+
 void AreaFormCube::calcWorldPos(TVec3f *pPos) const {
     if (_4 != NULL) {
         _4->mult(mTranslation, *pPos);
@@ -204,6 +248,12 @@ bool AreaFormSphere::isInVolume(const TVec3f &rVector) const {
     return PSVECMag(&otherPos) < _14;
 }
 
+void AreaFormSphere::calcWorldBounds(TBox3f *pBox) const {
+    TVec3f pos;
+    calcPos(&pos);
+    setBoundsSphere(pBox, pos, _14);
+}
+
 AreaFormBowl::AreaFormBowl() {
     _4 = NULL;
     mTranslation.x = 0.0f;
@@ -239,6 +289,10 @@ bool AreaFormBowl::isInVolume(const TVec3f &rPos) const {
     return otherPos.dot(mUp) < 0.0f;
 }
 
+void AreaFormBowl::calcWorldBounds(TBox3f *pBox) const {
+    setBoundsSphere(pBox, mTranslation, _20);
+}
+
 void AreaFormBowl::calcUpVec(const TVec3f &rPos) {
     TVec3f up(0.0f, 1.0f, 0.0f);
 
@@ -312,6 +366,23 @@ bool AreaFormCylinder::isInVolume(const TVec3f &rVec) const {
     return ret;
 }
 
+void AreaFormCylinder::calcWorldBounds(TBox3f *pBox) const {
+    TVec3f pos;
+    calcPos(&pos);
+
+    TVec3f up;
+    calcUpVec(&up);
+
+    TVec3f top(pos);
+    top.add(up * _24);
+
+    setBoundsSphere(pBox, pos, _20);
+    TBox3f topBox;
+    setBoundsSphere(&topBox, top, _20);
+    extendBounds(pBox, topBox.mMin);
+    extendBounds(pBox, topBox.mMax);
+}
+
 void AreaFormCylinder::calcDir(const TVec3f &a1) {
     mRotation.x = 0.0f;
     mRotation.y = 1.0f;
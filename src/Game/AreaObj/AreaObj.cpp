@@ -2,6 +2,7 @@
 #include "Game/AreaObj/AreaObj.hpp"
 #include "Game/AreaObj/AreaObjFollower.hpp"
 #include "Game/Map/SleepControllerHolder.hpp"
+#include <revolution/os.h>
 
 AreaObj::AreaObj(int type, const char *pName) :
     NameObj(pName),
@@ -66,8 +67,15 @@ void AreaObj::init(const JMapInfoIter &rIter) {
         setName(pName);
     }
 
-    MR::getAreaObjManager(getManagerName())->entry(this);
-    MR::getAreaObjManager(getManagerName());
+    AreaObjMgr* mgr = MR::getAreaObjManager(getManagerName());
+
+    // no manager for this area means the placement names an area the scene doesn't know
+    if (mgr == nullptr) {
+        OSPanic(__FILE__, __LINE__, "AreaObj: no manager for %s (%s)", mName, getManagerName());
+    }
+
+    mgr->entry(this);
+
     SleepControlFunc::addSleepControl(this, rIter);
 }
 
@@ -107,23 +115,229 @@ TPos3f* AreaObj::getFollowMtx() const {
     return mForm->_4;
 }
 
+namespace {
+    const s32 cIndexLeafNumMax = 4;
+    const s32 cIndexStackSize = 64;
+    // covers rounding between the forward transformed bounds and the inverse transform in isInVolume
+    const f32 cIndexBoundsMargin = 1.0f;
+
+    inline bool isInBounds(const TBox3f &rBounds, const TVec3f &rPos) {
+        return rPos.x >= rBounds.mMin.x && rPos.y >= rBounds.mMin.y && rPos.z >= rBounds.mMin.z
+            && rPos.x <= rBounds.mMax.x && rPos.y <= rBounds.mMax.y && rPos.z <= rBounds.mMax.z;
+    }
+
+    inline f32 getBoundsCenter(const TBox3f &rBounds, s32 axis) {
+        switch (axis) {
+            case 0:
+                return rBounds.mMin.x + rBounds.mMax.x;
+            case 1:
+                return rBounds.mMin.y + rBounds.mMax.y;
+            default:
+                return rBounds.mMin.z + rBounds.mMax.z;
+        }
+    }
+};
+
 AreaObjMgr::AreaObjMgr(s32 count, const char* pName) :
     NameObj(pName),
     mArray(),
     _18(count)
 {
-    
+    mIndexNodes = nullptr;
+    mIndexNodeNum = 0;
+    mIndexLeaves = nullptr;
+    mIndexBounds = nullptr;
+    mFollowEntries = nullptr;
+    mFollowEntryNum = 0;
+    mIsValidIndex = false;
 }
 
 void AreaObjMgr::entry(AreaObj *pAreaObj) {
     if (mArray.capacity() == 0) {
         mArray.init(_18);
+        initIndex();
     }
 
     mArray.push_back(pAreaObj);
+    mIsValidIndex = false;
+}
+
+// first entry in order containing the position, like a plain scan over mArray
+AreaObj* AreaObjMgr::find_in(const TVec3f &rPos) const {
+    s32 index = findIndex(rPos, -1);
+    return index >= 0 ? mArray[index] : nullptr;
 }
 
-// AreaObjMgr::find_in
+// a hint that still contains the position bounds the search to the entries before it, returns -1 when outside
+s32 AreaObjMgr::findIndex(const TVec3f &rPos, s32 hintIndex) const {
+    if (!mIsValidIndex) {
+        const_cast<AreaObjMgr*>(this)->updateIndex();
+    }
+
+    s32 found = mArray.size();
+
+    if (hintIndex >= 0 && hintIndex < found && mArray[hintIndex]->isInVolume(rPos)) {
+        found = hintIndex;
+    }
+
+    found = findIndexTree(rPos, found);
+
+    for (s32 i = 0; i < mFollowEntryNum; i++) {
+        s32 index = mFollowEntries[i];
+
+        if (index >= found) {
+            break;
+        }
+
+        if (mArray[index]->isInVolume(rPos)) {
+            found = index;
+            break;
+        }
+    }
+
+    return found < mArray.size() ? found : -1;
+}
+
+// call when entries are reordered or their forms move
+void AreaObjMgr::invalidateIndex() {
+    mIsValidIndex = false;
+}
+
+// sized for the full capacity up front so rebuilding never allocates
+void AreaObjMgr::initIndex() {
+    mIndexNodes = new AreaObjIndexNode[_18 * 2];
+    mIndexLeaves = new s32[_18];
+    mIndexBounds = new TBox3f[_18];
+    mFollowEntries = new s32[_18];
+}
+
+// areas following a base matrix move every frame, so they stay out of the tree and are tested one by one
+void AreaObjMgr::updateIndex() {
+    s32 leafNum = 0;
+    mFollowEntryNum = 0;
+    mIndexNodeNum = 0;
+
+    for (s32 i = 0; i < mArray.size(); i++) {
+        AreaObj* pAreaObj = mArray[i];
+
+        if (pAreaObj->getFollowMtx() != nullptr) {
+            mFollowEntries[mFollowEntryNum++] = i;
+        }
+        else {
+            TBox3f* pBounds = &mIndexBounds[i];
+            pAreaObj->mForm->calcWorldBounds(pBounds);
+            pBounds->mMin.x -= cIndexBoundsMargin;
+            pBounds->mMin.y -= cIndexBoundsMargin;
+            pBounds->mMin.z -= cIndexBoundsMargin;
+            pBounds->mMax.x += cIndexBoundsMargin;
+            pBounds->mMax.y += cIndexBoundsMargin;
+            pBounds->mMax.z += cIndexBoundsMargin;
+            mIndexLeaves[leafNum++] = i;
+        }
+    }
+
+    if (leafNum > 0) {
+        buildIndexNode(0, leafNum);
+    }
+
+    mIsValidIndex = true;
+}
+
+// splits the leaves at the median of the longest axis, returns the node index
+s32 AreaObjMgr::buildIndexNode(s32 start, s32 num) {
+    s32 nodeIndex = mIndexNodeNum++;
+    AreaObjIndexNode* pNode = &mIndexNodes[nodeIndex];
+    pNode->mBounds = mIndexBounds[mIndexLeaves[start]];
+    pNode->mMinArrayIndex = mIndexLeaves[start];
+
+    for (s32 i = start + 1; i < start + num; i++) {
+        const TBox3f& rBounds = mIndexBounds[mIndexLeaves[i]];
+        pNode->mBounds.mMin.x = rBounds.mMin.x < pNode->mBounds.mMin.x ? rBounds.mMin.x : pNode->mBounds.mMin.x;
+        pNode->mBounds.mMin.y = rBounds.mMin.y < pNode->mBounds.mMin.y ? rBounds.mMin.y : pNode->mBounds.mMin.y;
+        pNode->mBounds.mMin.z = rBounds.mMin.z < pNode->mBounds.mMin.z ? rBounds.mMin.z : pNode->mBounds.mMin.z;
+        pNode->mBounds.mMax.x = rBounds.mMax.x > pNode->mBounds.mMax.x ? rBounds.mMax.x : pNode->mBounds.mMax.x;
+        pNode->mBounds.mMax.y = rBounds.mMax.y > pNode->mBounds.mMax.y ? rBounds.mMax.y : pNode->mBounds.mMax.y;
+        pNode->mBounds.mMax.z = rBounds.mMax.z > pNode->mBounds.mMax.z ? rBounds.mMax.z : pNode->mBounds.mMax.z;
+
+        if (mIndexLeaves[i] < pNode->mMinArrayIndex) {
+            pNode->mMinArrayIndex = mIndexLeaves[i];
+        }
+    }
+
+    if (num <= cIndexLeafNumMax) {
+        pNode->mRight = -1;
+        pNode->mLeafStart = start;
+        pNode->mLeafNum = num;
+        return nodeIndex;
+    }
+
+    f32 sizeX = pNode->mBounds.mMax.x - pNode->mBounds.mMin.x;
+    f32 sizeY = pNode->mBounds.mMax.y - pNode->mBounds.mMin.y;
+    f32 sizeZ = pNode->mBounds.mMax.z - pNode->mBounds.mMin.z;
+    s32 axis = 0;
+
+    if (sizeY > sizeX && sizeY >= sizeZ) {
+        axis = 1;
+    }
+    else if (sizeZ > sizeX && sizeZ > sizeY) {
+        axis = 2;
+    }
+
+    for (s32 i = start + 1; i < start + num; i++) {
+        s32 leaf = mIndexLeaves[i];
+        f32 center = getBoundsCenter(mIndexBounds[leaf], axis);
+        s32 j = i;
+
+        while (j > start && getBoundsCenter(mIndexBounds[mIndexLeaves[j - 1]], axis) > center) {
+            mIndexLeaves[j] = mIndexLeaves[j - 1];
+            j--;
+        }
+
+        mIndexLeaves[j] = leaf;
+    }
+
+    s32 half = num / 2;
+    pNode->mLeafStart = start;
+    pNode->mLeafNum = 0;
+    buildIndexNode(start, half);
+    pNode->mRight = buildIndexNode(start + half, num - half);
+    return nodeIndex;
+}
+
+// returns the lowest entry below found containing the position, or found itself
+s32 AreaObjMgr::findIndexTree(const TVec3f &rPos, s32 found) const {
+    if (mIndexNodeNum == 0) {
+        return found;
+    }
+
+    s32 stack[cIndexStackSize];
+    s32 stackNum = 0;
+    stack[stackNum++] = 0;
+
+    while (stackNum > 0) {
+        const AreaObjIndexNode* pNode = &mIndexNodes[stack[--stackNum]];
+
+        if (pNode->mMinArrayIndex >= found || !isInBounds(pNode->mBounds, rPos)) {
+            continue;
+        }
+
+        if (pNode->mLeafNum == 0) {
+            stack[stackNum++] = pNode->mRight;
+            stack[stackNum++] = pNode - mIndexNodes + 1;
+            continue;
+        }
+
+        for (s32 i = pNode->mLeafStart; i < pNode->mLeafStart + pNode->mLeafNum; i++) {
+            s32 index = mIndexLeaves[i];
+
+            if (index < found && isInBounds(mIndexBounds[index], rPos) && mArray[index]->isInVolume(rPos)) {
+                found = index;
+            }
+        }
+    }
+
+    return found;
+}
 
 void AreaObj::validate() {
     mIsValid = true;
@@ -1,10 +1,17 @@
 #include "Game/AreaObj/AreaObjContainer.hpp"
 #include "Game/AreaObj/AreaObj.hpp"
 #include "Game/Scene/SceneObjHolder.hpp"
+#include "Game/Util/HashUtil.hpp"
+#include "Game/Util/StringUtil.hpp"
 #include <cstring>
 
 AreaObjContainer::AreaObjContainer(const char *pName) : NameObj(pName) {
     mNumManagers = 0;
+
+    for (u32 i = 0; i < 0x80; i++) {
+        mManagerTableName[i] = nullptr;
+        mManagerTable[i] = nullptr;
+    }
 }
 
 void AreaObjContainer::init(const JMapInfoIter &rIter) {
@@ -19,26 +26,86 @@ void AreaObjContainer::init(const JMapInfoIter &rIter) {
         mNumManagers++;
         mManagerArray[num] = mgr;
     }
+
+    for (u32 i = 0; i < mNumManagers; i++) {
+        addManagerTable(mManagerArray[i]);
+    }
 }
 
-/* this function is nearly impossible to match without context behind the random stack storages */
+// callers almost always pass a manager name as is, so those resolve by hash without the prefix scan
+// nullptr when no manager name starts the given name
 AreaObjMgr* AreaObjContainer::getManager(const char *pName) const {
-    const char * str;
-    AreaObjMgr** first = (AreaObjMgr**)&mManagerArray[0];
-    AreaObjMgr** last = (AreaObjMgr**)&mManagerArray[mNumManagers];
-    
-    while ((str && str == pName) == false) {
-        if (++first == last)
+    HashProbe probe(MR::getMixedHashCode(MR::getHashCode(pName)), 0x80, 0x80);
+
+    while (mManagerTableName[probe.getSlot()] != nullptr) {
+        if (MR::isEqualString(mManagerTableName[probe.getSlot()], pName)) {
+            return mManagerTable[probe.getSlot()];
+        }
+
+        if (!probe.next()) {
             break;
+        }
+    }
+
+    return findManager(pName);
+}
 
-        str = strstr(pName, (*first)->mName);   
+// first manager whose name starts the given name
+AreaObjMgr* AreaObjContainer::findManager(const char *pName) const {
+    for (u32 i = 0; i < mNumManagers; i++) {
+        if (strstr(pName, mManagerArray[i]->mName) == pName) {
+            return mManagerArray[i];
+        }
     }
 
-    return *first;
+    return nullptr;
+}
+
+void AreaObjContainer::addManagerTable(AreaObjMgr *pMgr) {
+    const char* pName = pMgr->mName;
+    HashProbe probe(MR::getMixedHashCode(MR::getHashCode(pName)), 0x80, 0x80);
+
+    while (mManagerTableName[probe.getSlot()] != nullptr) {
+        if (MR::isEqualString(mManagerTableName[probe.getSlot()], pName)) {
+            return;
+        }
+
+        if (!probe.next()) {
+            return;
+        }
+    }
+
+    mManagerTableName[probe.getSlot()] = pName;
+    mManagerTable[probe.getSlot()] = findManager(pName);
 }
  
 AreaObj* AreaObjContainer::getAreaObj(const char *pName, const TVec3f &rVec) const {
-    return getManager(pName)->find_in(rVec);
+    AreaObjMgr* mgr = getManager(pName);
+
+    if (mgr == nullptr) {
+        return nullptr;
+    }
+
+    return mgr->find_in(rVec);
+}
+
+// results are laid out per position, one for each manager, and the previous results serve as hints
+void AreaObjContainer::findAreaObjs(const char **pMgrNames, s32 mgrNum, const TVec3f *pPosArray, s32 posNum, AreaObjQueryResult *pResults) const {
+    for (s32 i = 0; i < mgrNum; i++) {
+        const AreaObjMgr* mgr = getManager(pMgrNames[i]);
+        AreaObjQueryResult* pResult = &pResults[i];
+
+        for (s32 j = 0; j < posNum; j++, pResult += mgrNum) {
+            if (mgr == nullptr) {
+                pResult->mIndex = -1;
+                pResult->mAreaObj = nullptr;
+                continue;
+            }
+
+            pResult->mIndex = mgr->findIndex(pPosArray[j], pResult->mIndex);
+            pResult->mAreaObj = pResult->mIndex >= 0 ? mgr->mArray[pResult->mIndex] : nullptr;
+        }
+    }
 }
 
 namespace MR {
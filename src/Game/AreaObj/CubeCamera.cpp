@@ -95,6 +95,7 @@ CubeCameraMgr::CubeCameraMgr(s32 type, const char *pName) : AreaObjMgr(type, pNa
 
 void CubeCameraMgr::initAfterLoad() {
     sort();
+    invalidateIndex();
 }
 
 // CubeCameraMgr::sort
@@ -4,11 +4,19 @@
 #include "Game/Camera/CameraParamChunkHolder.hpp"
 #include "Game/Camera/CameraParamChunkID.hpp"
 #include "Game/Camera/DotCamParams.hpp"
+#include "Game/Util/HashUtil.hpp"
 #include "Game/Util/SceneUtil.hpp"
 #include "JSystem/JKernel/JKRHeap.hpp"
 #include <cstring>
 
 #define CHUNK_CAPACITY 0x400
+#define CHUNK_TABLE_SIZE (CHUNK_CAPACITY * 2)
+
+namespace {
+    u32 getChunkTableHashCode(s32 zoneID, const char *pName) {
+        return MR::getMixedHashCode(MR::getHashCode(pName) + static_cast<s8>(zoneID));
+    }
+};
 
 CameraParamChunkHolder::CameraParamChunkHolder(CameraHolder *pCameraHolder, const char *pName) : NameObj(pName) {
     mCameraHolder = pCameraHolder;
@@ -16,6 +24,11 @@ CameraParamChunkHolder::CameraParamChunkHolder(CameraHolder *pCameraHolder, cons
     mNrChunks = 0;
     mChunks = new CameraParamChunk *[CHUNK_CAPACITY];
     mIsSorted = 0;
+    mChunkTable = new CameraParamChunk *[CHUNK_TABLE_SIZE];
+
+    for (s32 i = 0; i < CHUNK_TABLE_SIZE; i++) {
+        mChunkTable[i] = nullptr;
+    }
 }
 
 CameraParamChunkHolder::~CameraParamChunkHolder() {
@@ -38,7 +51,8 @@ CameraParamChunk *CameraParamChunkHolder::createChunk(const CameraParamChunkID &
         }
 
         mChunks[mNrChunks++] = chunk;
-        
+        addChunkTable(chunk);
+
         return chunk;
     }
     
@@ -81,6 +95,10 @@ void CameraParamChunkHolder::loadCameraParameters() {
 }
 
 bool CameraParamChunkHolder::isNewAttribute(const CameraParamChunkID &rID) {
+    if (rID.mName != nullptr) {
+        return findChunkTable(rID.mZoneID, rID.mName) == nullptr;
+    }
+
     for (s32 i = 0; i < mNrChunks; i++) {
         if (*mChunks[i]->mParamChunkID == rID) {
             return false;
@@ -91,6 +109,10 @@ bool CameraParamChunkHolder::isNewAttribute(const CameraParamChunkID &rID) {
 }
 
 CameraParamChunk *CameraParamChunkHolder::findChunk(const CameraParamChunkID &rID) {
+    if (rID.mName != nullptr) {
+        return findChunkTable(rID.mZoneID, rID.mName);
+    }
+
     if (mIsSorted) {
         s32 low = 0;
         s32 high = mNrChunks - 1;
@@ -122,9 +144,38 @@ CameraParamChunk *CameraParamChunkHolder::findChunk(const CameraParamChunkID &rI
 }
 
 CameraParamChunk *CameraParamChunkHolder::findChunk(s32 zoneID, const char *pName) {
-    for (s32 i = 0; i < mNrChunks; i++) {
-        if (mChunks[i]->mParamChunkID->equals(zoneID, pName)) {
-            return mChunks[i];
+    return findChunkTable(zoneID, pName);
+}
+
+// chunks are entered as they are created, so the table also serves the lookups made while loading
+void CameraParamChunkHolder::addChunkTable(CameraParamChunk *pChunk) {
+    const CameraParamChunkID *id = pChunk->mParamChunkID;
+
+    if (id->mName == nullptr) {
+        return;
+    }
+
+    HashProbe probe(getChunkTableHashCode(id->mZoneID, id->mName), CHUNK_TABLE_SIZE, CHUNK_TABLE_SIZE);
+
+    while (mChunkTable[probe.getSlot()] != nullptr) {
+        if (!probe.next()) {
+            return;
+        }
+    }
+
+    mChunkTable[probe.getSlot()] = pChunk;
+}
+
+CameraParamChunk *CameraParamChunkHolder::findChunkTable(s32 zoneID, const char *pName) const {
+    HashProbe probe(getChunkTableHashCode(zoneID, pName), CHUNK_TABLE_SIZE, CHUNK_TABLE_SIZE);
+
+    while (mChunkTable[probe.getSlot()] != nullptr) {
+        if (mChunkTable[probe.getSlot()]->mParamChunkID->equals(zoneID, pName)) {
+            return mChunkTable[probe.getSlot()];
+        }
+
+        if (!probe.next()) {
+            break;
         }
     }
 
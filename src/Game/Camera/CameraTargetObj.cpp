@@ -20,6 +20,7 @@ CameraTargetActor::CameraTargetActor(const char *pName) : CameraTargetObj(pName)
     mSide.y = 0.0f;
     mSide.z = 1.0f;
     mCameraArea = nullptr;
+    MR::initAreaObjQueryResult(&mCameraAreaQuery, 1);
 }
 
 CameraTargetActor::~CameraTargetActor() {
@@ -45,7 +46,7 @@ void CameraTargetActor::movement() {
         matrix.getXDir(mSide);
     }
 
-    CubeCameraArea *area = reinterpret_cast<CubeCameraArea *>(MR::getAreaObj("CubeCamera", mActor->mPosition));
+    CubeCameraArea *area = reinterpret_cast<CubeCameraArea *>(MR::findAreaObj("CubeCamera", mActor->mPosition, &mCameraAreaQuery));
 
     if (area == nullptr) {
         mCameraArea = nullptr;
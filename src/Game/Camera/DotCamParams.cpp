@@ -11,6 +11,8 @@ DotCamReaderInBin::DotCamReaderInBin(const void *pData) :
     mMapIter.mInfo = nullptr;
     mMapIter.mIndex = -1;
     init(pData);
+    // every chunk reads its fields by name, the view goes away with the reader
+    mMapInfo.createDecodedView();
 }
 
 DotCamReaderInBin::~DotCamReaderInBin() {
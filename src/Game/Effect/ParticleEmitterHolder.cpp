@@ -1,9 +1,83 @@
 #include "Game/Effect/EffectSystem.hpp"
 #include "Game/Effect/ParticleEmitterHolder.hpp"
 
-// Not sure how to make this match.
-// ParticleEmitterHolder::ParticleEmitterHolder(EffectSystem const *pEffectSystem, int numEmitters) {
-//     mEffectSystem = pEffectSystem;
-//     mEmitters.init(numEmitters);
-//     mNumEmitters = numEmitters;
-// }
\ No newline at end of file
+namespace {
+    // mNextFree of an emitter that is handed out
+    const u16 cNotInFreeList = 0xFFFE;
+    const u16 cFreeListEnd = 0xFFFF;
+    const int cPoolSlotNum = (sizeof(ParticleEmitterPool) + sizeof(ParticleEmitter) - 1) / sizeof(ParticleEmitter);
+};
+
+ParticleEmitterHolder::ParticleEmitterHolder(EffectSystem const *pEffectSystem, int numEmitters) {
+    mEffectSystem = pEffectSystem;
+    mEmitters.init(numEmitters + cPoolSlotNum);
+    mNumEmitters = numEmitters;
+
+    // every emitter starts out free, linked in order so the first ones are handed out first
+    for (int i = 0; i < numEmitters; i++) {
+        mEmitters[i].mNextFree = i + 1 < numEmitters ? i + 1 : cFreeListEnd;
+    }
+
+    ParticleEmitterPool* pPool = getPool();
+    pPool->mFreeHead = numEmitters != 0 ? 0 : cFreeListEnd;
+    pPool->mCreateNum = 0;
+    pPool->mCreateNumMax = numEmitters;
+    pPool->mPoolHitNum = 0;
+    pPool->mPoolMissNum = 0;
+    pPool->mCullNum = 0;
+}
+
+// one-time emitters go first: over the per-frame cap, or once the pool is empty, they are culled.
+// continuous ones are never culled since they would stay missing, an empty pool is a miss for them
+ParticleEmitter* ParticleEmitterHolder::getUnusedParticleEmitter(bool isOneTime) {
+    ParticleEmitterPool* pPool = getPool();
+
+    if (isOneTime && pPool->mCreateNum >= pPool->mCreateNumMax) {
+        pPool->mCullNum++;
+        return nullptr;
+    }
+
+    if (pPool->mFreeHead == cFreeListEnd) {
+        if (isOneTime) {
+            pPool->mCullNum++;
+        }
+        else {
+            pPool->mPoolMissNum++;
+        }
+
+        return nullptr;
+    }
+
+    ParticleEmitter* pEmitter = &mEmitters[pPool->mFreeHead];
+    pPool->mFreeHead = pEmitter->mNextFree;
+    pEmitter->mNextFree = cNotInFreeList;
+    pPool->mPoolHitNum++;
+    pPool->mCreateNum++;
+
+    return pEmitter;
+}
+
+// called once the emitter died or was deleted, the slot is handed out again right away.
+// releasing an emitter that is already free does nothing
+void ParticleEmitterHolder::releaseParticleEmitter(ParticleEmitter *pEmitter) {
+    if (pEmitter->mNextFree != cNotInFreeList) {
+        return;
+    }
+
+    ParticleEmitterPool* pPool = getPool();
+    pEmitter->invalidate();
+    pEmitter->mNextFree = pPool->mFreeHead;
+    pPool->mFreeHead = pEmitter - &mEmitters[0];
+}
+
+void ParticleEmitterHolder::resetCreateCount() {
+    getPool()->mCreateNum = 0;
+}
+
+void ParticleEmitterHolder::setCreateNumMax(s32 num) {
+    getPool()->mCreateNumMax = num;
+}
+
+ParticleEmitterPool* ParticleEmitterHolder::getPool() const {
+    return reinterpret_cast<ParticleEmitterPool*>(const_cast<ParticleEmitter*>(&mEmitters[mNumEmitters]));
+}
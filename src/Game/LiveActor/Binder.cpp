@@ -22,7 +22,7 @@ HitInfo &HitInfo::operator=(const HitInfo &rOther)
     return *this;
 }
 
-Binder::Binder(MtxPtr mtx, const TVec3f *v1, const TVec3f *v2, f32 a, f32 b, u32 c) : BinderParent(mtx), _10(v1), _14(v2), _18(a), _1C(b), _20(0), _24(c), _28(0), _2C(0), _30(0, 0, 0), _3C(), _CC(), _15C(), _C8(131076.953125f), _158(131076.953125f), _1E8(131076.953125f)
+Binder::Binder(MtxPtr mtx, const TVec3f *v1, const TVec3f *v2, f32 a, f32 b, u32 c) : BinderParent(mtx), _10(v1), _14(v2), _18(a), _1C(b), _20(0), _24(c), _28(0), _2C(0), _30(0, 0, 0), mFloorInfo(), _CC(), _15C(), _C8(131076.953125f), _158(131076.953125f), _1E8(131076.953125f)
 {
     if (!_24) {
         _2C = nullptr;
@@ -1,6 +1,12 @@
 #include "Game/LiveActor/ClippingActorHolder.hpp"
 #include "Game/LiveActor/LiveActor.hpp"
 #include "Game/Util.hpp"
+#include "Game/Util/HashUtil.hpp"
+
+namespace {
+    // one slot per actor of the scene, as many as AllLiveActorGroup holds
+    static int sActorNumMax = 0xA00;
+};
 
 ClippingActorHolder::ClippingActorHolder() : NameObj("クリッピングアクター保持") {
     _C = 0;
@@ -9,12 +15,29 @@ ClippingActorHolder::ClippingActorHolder() : NameObj("クリッピングアク
     _18 = 0;
     _1C = 0;
     mViewGroupCtrl = 0;
+    mInfoTable = 0;
+    mInfoTableMask = 0;
+    mLodCtrlHolder = 0;
 
     _10 = new ClippingActorInfoList(sActorNumMax);
     _14 = new ClippingActorInfoList(sActorNumMax);
     _18 = new ClippingActorInfoList(sActorNumMax);
     _1C = new ClippingActorInfoList(sActorNumMax);
     mViewGroupCtrl = new ViewGroupCtrl();
+    mLodCtrlHolder = new LodCtrlHolder(sActorNumMax);
+
+    // open addressed, kept at most half full
+    u32 tableSize = 0x10;
+    while (tableSize < sActorNumMax * 2) {
+        tableSize <<= 1;
+    }
+
+    mInfoTable = new ClippingActorInfo*[tableSize];
+    mInfoTableMask = tableSize - 1;
+
+    for (u32 i = 0; i < tableSize; i++) {
+        mInfoTable[i] = 0;
+    }
 }
 
 void ClippingActorHolder::movement() {
@@ -23,11 +46,18 @@ void ClippingActorHolder::movement() {
     for (s32 i = 0; i < _10->_4; i++) {
         _10->mClippingActorList[i]->judgeClipping();
     }
+
+    mLodCtrlHolder->update();
 }
 
 void ClippingActorHolder::registerActor(LiveActor *pActor) {
+    if (_C >= sActorNumMax) {
+        OSPanic(__FILE__, __LINE__, "ClippingActorHolder: too many actors (max %d)", sActorNumMax);
+    }
+
     ClippingActorInfo* inf = new ClippingActorInfo(pActor);
     _18->add(inf);
+    addToInfoTable(inf);
     _C++;
 }
 
@@ -51,11 +81,13 @@ void ClippingActorHolder::initViewGroupTable() {
 
 void ClippingActorHolder::entryLodCtrl(LodCtrl *pLod, const JMapInfoIter &rIter) {
     mViewGroupCtrl->entryLodCtrl(pLod, rIter);
+    mLodCtrlHolder->registerLodCtrl(pLod);
 }
 
 void ClippingActorHolder::validateClipping(LiveActor *pActor) {
     pActor->mFlags.mIsInvalidClipping = false;
-    ClippingActorInfo* inf = _14->remove(pActor);
+    ClippingActorInfo* inf = find(pActor);
+    _14->remove(inf);
 
     if (MR::isDead(pActor)) {
         _18->add(inf);
@@ -72,19 +104,8 @@ void ClippingActorHolder::validateClipping(LiveActor *pActor) {
 
 void ClippingActorHolder::invalidateClipping(LiveActor *pActor) {
     pActor->mFlags.mIsInvalidClipping = true;
-    ClippingActorInfo* inf;
-
-    if (MR::isDead(pActor)) {
-        inf = _18->remove(pActor);
-    }
-    else {
-        if (_10->isInList(pActor)) {
-            inf = _10->remove(pActor);
-        }
-        else {
-            inf = _1C->remove(pActor);
-        }
-    }
+    ClippingActorInfo* inf = find(pActor);
+    inf->mList->remove(inf);
 
     _14->add(inf);
     if (MR::isClipped(pActor)) {
@@ -101,4 +122,35 @@ void ClippingActorHolder::setTypeToSphere(LiveActor *pActor, f32 range, const TV
 void ClippingActorHolder::setFarClipLevel(LiveActor *pActor, s32 level) {
     find(pActor)->mFarClipLevel = level;
 }
-#endif
\ No newline at end of file
+#endif
+
+ClippingActorInfo* ClippingActorHolder::find(const LiveActor *pActor) const {
+    u32 tableSize = mInfoTableMask + 1;
+    HashProbe probe(MR::getPointerHashCode(pActor), tableSize, tableSize);
+
+    while (mInfoTable[probe.getSlot()]) {
+        if (mInfoTable[probe.getSlot()]->mActor == pActor) {
+            return mInfoTable[probe.getSlot()];
+        }
+
+        if (!probe.next()) {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+void ClippingActorHolder::addToInfoTable(ClippingActorInfo *pInfo) {
+    u32 tableSize = mInfoTableMask + 1;
+    HashProbe probe(MR::getPointerHashCode(pInfo->mActor), tableSize, tableSize);
+
+    // registerActor keeps the table at most half full, so a free slot is always found
+    while (mInfoTable[probe.getSlot()]) {
+        if (!probe.next()) {
+            return;
+        }
+    }
+
+    mInfoTable[probe.getSlot()] = pInfo;
+}
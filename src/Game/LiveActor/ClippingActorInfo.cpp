@@ -1,9 +1,10 @@
 #include "Game/LiveActor/ClippingActorInfo.hpp"
 #include "Game/LiveActor/ClippingJudge.hpp"
 #include "Game/LiveActor/LiveActor.hpp"
+#include "Game/LiveActor/ViewGroupCtrl.hpp"
 #include "Game/Util.hpp"
 
-ClippingActorInfo::ClippingActorInfo(LiveActor *pActor) {
+ClippingActorInfo::ClippingActorInfo(LiveActor *pActor) : mJudgedPos(0.0f, 0.0f, 0.0f) {
     mActor = pActor;
     _4 = 0;
     _8 = 0.0f;
@@ -11,11 +12,29 @@ ClippingActorInfo::ClippingActorInfo(LiveActor *pActor) {
     mFarClipLevel = 6;
     _12 = -1;
     _14 = 0;
+    mList = 0;
+    mListIndex = -1;
+    mJudgedMargin = -1.0f;
+    mJudgedCameraDist = 0.0f;
+    mCameraMoveSum = 0.0f;
+    mCameraTurnSum = 0.0f;
+    mJudgedFarClipLevel = -1;
+    mIsJudgedClip = false;
     setTypeToSphere(300.0f, 0);
 }
 
 void ClippingActorInfo::judgeClipping() {
-    if (isJudgedToClip()) {
+    ClippingJudge* judge = MR::getClippingJudge();
+    bool isClip;
+
+    if (judge->mIsCoherenceMode) {
+        isClip = isJudgedToClipCoherence(judge);
+    }
+    else {
+        isClip = isJudgedToClip();
+    }
+
+    if (isClip) {
         if (!MR::isClipped(mActor)) {
             mActor->startClipped();
         }
@@ -27,18 +46,42 @@ void ClippingActorInfo::judgeClipping() {
     }
 }
 
-/*
 bool ClippingActorInfo::isJudgedToClip() const {
-    s32 farClipLevel = mFarClipLevel;
-    if (*_14 == 1) {
-        farClipLevel = 0;
+    ClippingJudge* judge = MR::getClippingJudge();
+    return judge->isJudgedToClipFrustum(*_4, _8, getFarClipLevel());
+}
+
+// only re-tests once the camera and actor could have moved far enough to cross a frustum plane
+bool ClippingActorInfo::isJudgedToClipCoherence(const ClippingJudge *pJudge) {
+    s32 farClipLevel = getFarClipLevel();
+    f32 actorMove = PSVECDistance(_4, &mJudgedPos);
+
+    mCameraMoveSum += pJudge->mCameraMove;
+    mCameraTurnSum += pJudge->mCameraTurn;
+
+    f32 bound = mCameraMoveSum + actorMove;
+    bound += mCameraTurnSum * (mJudgedCameraDist + bound);
+
+    if (farClipLevel == mJudgedFarClipLevel && bound < mJudgedMargin) {
+        return mIsJudgedClip;
     }
 
-    f32 val = _8;
-    ClippingJudge* judge = MR::getClippingJudge();
-    return judge->isJudgedToClipFrustum(*_4, val, farClipLevel);
+    mIsJudgedClip = pJudge->isJudgedToClipFrustumWithMargin(*_4, _8, farClipLevel, &mJudgedMargin);
+    mJudgedPos.set(*_4);
+    mJudgedCameraDist = PSVECDistance(_4, &pJudge->mCameraPos);
+    mJudgedFarClipLevel = farClipLevel;
+    mCameraMoveSum = 0.0f;
+    mCameraTurnSum = 0.0f;
+    return mIsJudgedClip;
+}
+
+s32 ClippingActorInfo::getFarClipLevel() const {
+    if (_14 && _14->_0) {
+        return 0;
+    }
+
+    return mFarClipLevel;
 }
-*/
 
 bool ClippingActorInfo::isGroupClipping() const {
     return mInfo;
@@ -46,6 +89,7 @@ bool ClippingActorInfo::isGroupClipping() const {
 
 void ClippingActorInfo::setTypeToSphere(f32 a1, const TVec3f *a2) {
     _8 = a1;
+    mJudgedMargin = -1.0f;
     if (!a2) {
         _4 = &mActor->mPosition;
     }
@@ -76,9 +120,39 @@ ClippingActorInfoList::ClippingActorInfoList(int a1) {
 
 void ClippingActorInfoList::add(ClippingActorInfo *pInfo) {
     mClippingActorList[_4] = pInfo;
+    pInfo->mList = this;
+    pInfo->mListIndex = _4;
+    // the last judgement was made before the actor left the judged list, so the next one tests again
+    pInfo->mJudgedMargin = -1.0f;
     _4++;
 }
 
+// find falls back to the first entry, so a miss is caught here and leaves the list alone
+ClippingActorInfo* ClippingActorInfoList::remove(LiveActor *pActor) {
+    ClippingActorInfo* inf = find(pActor, 0);
+
+    if (inf == 0 || inf->mActor != pActor) {
+        return 0;
+    }
+
+    remove(inf);
+    return inf;
+}
+
+// the list is unordered, so the last entry is moved into the freed slot
+void ClippingActorInfoList::remove(ClippingActorInfo *pInfo) {
+    s32 idx = pInfo->mListIndex;
+    _4--;
+
+    ClippingActorInfo* last = mClippingActorList[_4];
+    mClippingActorList[idx] = last;
+    last->mListIndex = idx;
+    mClippingActorList[_4] = 0;
+
+    pInfo->mList = 0;
+    pInfo->mListIndex = -1;
+}
+
 ClippingActorInfo* ClippingActorInfoList::find(const LiveActor *pActor, s32 *pIndex) const {
     for (s32 i = 0; i < _4; i++) {
         ClippingActorInfo* inf = mClippingActorList[i];
@@ -106,4 +180,4 @@ bool ClippingActorInfoList::isInList(const LiveActor *pActor) const {
     }
 
     return false;
-}
\ No newline at end of file
+}
@@ -16,6 +16,7 @@ ClippingDirector::ClippingDirector() : NameObj("クリッピング指揮") {
 
 void ClippingDirector::endInitActorSystemInfo() {
     mActorHolder->initViewGroupTable();
+    MR::validateClippingCoherence();
 }
 
 void ClippingDirector::movement() {
@@ -1,7 +1,16 @@
 #include "Game/LiveActor/ClippingJudge.hpp"
+#include "Game/LiveActor/ClippingDirector.hpp"
 #include "Game/Util.hpp"
 
 ClippingJudge::ClippingJudge(const char *pName) : NameObj(pName), mFrustum() {
+    mIsCoherenceMode = false;
+    mIsValidPrevFrustum = false;
+    mCameraPos.x = 0.0f;
+    mCameraPos.y = 0.0f;
+    mCameraPos.z = 0.0f;
+    mCameraMove = FLOAT_MAX;
+    mCameraTurn = FLOAT_MAX;
+
     for (s32 i = 0; i < 8; i++) {
         mClipDistances[i] = -1.0f;
     }
@@ -26,6 +35,10 @@ void ClippingJudge::movement() {
     for (u32 i = 1; i < 8; i++) {
         calcViewingVolume(&mClipFrustums[i], mClipDistances[i]);
     }
+
+    if (mIsCoherenceMode) {
+        calcCameraMotion();
+    }
 }
 
 bool ClippingJudge::isJudgedToClipFrustum(const TVec3f &rVec, f32 a2) const {
@@ -36,8 +49,88 @@ bool ClippingJudge::isJudgedToClipFrustum(const TVec3f &rVec, f32 a2, s32 index)
     return (!index) ? !mFrustum.mayIntersectBall3(rVec, a2) : !mClipFrustums[index].mayIntersectBall3(rVec, a2);
 }
 
+// the verdict is mayIntersectBall3's own, which compares each plane distance against the radius, so it can only
+// change once some distance crosses +radius or -radius; the margin is the smallest gap to either crossing
+bool ClippingJudge::isJudgedToClipFrustumWithMargin(const TVec3f &rVec, f32 radius, s32 index, f32 *pMargin) const {
+    const THex3f* frustum = (!index) ? &mFrustum : &mClipFrustums[index];
+    f32 margin = FLOAT_MAX;
+
+    for (s32 i = 0; i < 6; i++) {
+        const JGeometry::TPartition3<f32>& plane = frustum->mPlanes[i];
+        f32 dist = plane.mNormal.dot(rVec) - plane.mDot;
+        f32 frontGap = __fabsf(dist - radius);
+        f32 backGap = __fabsf(dist + radius);
+
+        if (frontGap < margin) {
+            margin = frontGap;
+        }
+
+        if (backGap < margin) {
+            margin = backGap;
+        }
+    }
+
+    *pMargin = margin;
+    return !frustum->mayIntersectBall3(rVec, radius);
+}
+
 // ClippingJudge::calcViewingVolume
 
+// the clip frustums share their side and near planes with mFrustum and keep a fixed far distance,
+// so the motion of mFrustum bounds all of them
+void ClippingJudge::calcCameraMotion() {
+    TVec3f camPos = MR::getCamPos();
+
+    if (mIsValidPrevFrustum) {
+        f32 turn = 0.0f;
+        f32 offset = 0.0f;
+
+        for (s32 i = 0; i < 6; i++) {
+            const JGeometry::TPartition3<f32>& cur = mFrustum.mPlanes[i];
+            const JGeometry::TPartition3<f32>& prev = mPrevFrustum.mPlanes[i];
+
+            f32 normalDiff = PSVECDistance(&cur.mNormal, &prev.mNormal);
+            if (normalDiff > turn) {
+                turn = normalDiff;
+            }
+
+            f32 curOffset = cur.mDot - cur.mNormal.dot(camPos);
+            f32 prevOffset = prev.mDot - prev.mNormal.dot(mCameraPos);
+            f32 offsetDiff = __fabsf(curOffset - prevOffset);
+            if (offsetDiff > offset) {
+                offset = offsetDiff;
+            }
+        }
+
+        mCameraTurn = turn;
+        mCameraMove = offset + PSVECDistance(&camPos, &mCameraPos);
+    }
+    else {
+        mCameraTurn = FLOAT_MAX;
+        mCameraMove = FLOAT_MAX;
+    }
+
+    mPrevFrustum = mFrustum;
+    mCameraPos.set(camPos);
+    mIsValidPrevFrustum = true;
+}
+
 ClippingJudge::~ClippingJudge() {
 
-}
\ No newline at end of file
+}
+
+namespace MR {
+    ClippingJudge* getClippingJudge() {
+        return MR::getClippingDirector()->mJudge;
+    }
+
+    void validateClippingCoherence() {
+        ClippingJudge* judge = MR::getClippingJudge();
+        judge->mIsCoherenceMode = true;
+        judge->mIsValidPrevFrustum = false;
+    }
+
+    void invalidateClippingCoherence() {
+        MR::getClippingJudge()->mIsCoherenceMode = false;
+    }
+};
@@ -45,6 +45,10 @@ LodCtrl::LodCtrl(LiveActor *pActor, const JMapInfoIter &rIter) {
     _1B = 0;
     mViewGroupID = -1;
     mActorLightCtrl = nullptr;
+    mDistanceToCamera = 0.0f;
+    mRequestedLevel = 0;
+    mIsRequestedUpdate = false;
+    mIsEntryHolder = false;
     _1C = &def;
     _20 = &def;
     _24 = &def;
@@ -60,6 +64,8 @@ void LodCtrl::offSyncShadowHost() {
 
 void LodCtrl::appear() {
     MR::showModel(mActor);
+    // the middle and low models are put away below, so the level starts over at the high model
+    _8 = mActor;
     mActorLightCtrl = mActor->mActorLightCtrl;
 
     if (_10) {
@@ -81,6 +87,7 @@ void LodCtrl::appear() {
 
 void LodCtrl::kill() {
     MR::showModel(mActor);
+    _8 = mActor;
 
     if (_10) {
         if (!MR::isDead(_10)) {
@@ -111,6 +118,24 @@ void LodCtrl::invalidate() {
     _18 = 0;
 }
 
+// the model switch itself is done by LodCtrlHolder, see LodCtrlHolder::update
+void LodCtrl::update() {
+    if (!_18) {
+        return;
+    }
+
+    if (mIsEntryHolder) {
+        mIsRequestedUpdate = true;
+        return;
+    }
+
+    s32 level = calcRequestedLevel(0.0f);
+
+    if (level != getLodLevel()) {
+        showLodModel(level);
+    }
+}
+
 bool LodCtrl::isShowLowModel() const {
     ModelObj* obj = _14;
     bool ret = false;
@@ -320,6 +345,165 @@ ModelObj* LodCtrl::initLodModel(int a1, int a2, int a3, bool isLowModel) const {
     return obj;
 }
 
+s32 LodCtrl::getLodLevel() const {
+    if (_8 == mActor) {
+        return 0;
+    }
+
+    if (_8 != nullptr) {
+        if (_8 == _10) {
+            return 1;
+        }
+
+        if (_8 == _14) {
+            return 2;
+        }
+    }
+
+    return -1;
+}
+
+// the band around each switch distance keeps actors on a boundary from flipping every frame
+s32 LodCtrl::calcLodLevel(f32 dist, f32 hysteresisRate) const {
+    s32 curLevel = getLodLevel();
+    f32 toMiddle = curLevel >= 1 ? _0 * (1.0f - hysteresisRate) : _0 * (1.0f + hysteresisRate);
+    f32 toLow = curLevel >= 2 ? _4 * (1.0f - hysteresisRate) : _4 * (1.0f + hysteresisRate);
+
+    if (_14 && dist > toLow) {
+        return 2;
+    }
+
+    if (_10 && dist > toMiddle) {
+        return 1;
+    }
+
+    return 0;
+}
+
+// the view control flags win over the distance, -1 hides every model
+s32 LodCtrl::calcRequestedLevel(f32 hysteresisRate) {
+    mDistanceToCamera = calcDistanceToCamera();
+
+    if (*_1C) {
+        return -1;
+    }
+
+    if (*_20) {
+        return 0;
+    }
+
+    if (*_24 && _10) {
+        return 1;
+    }
+
+    if (*_28 && _14) {
+        return 2;
+    }
+
+    return calcLodLevel(mDistanceToCamera, hysteresisRate);
+}
+
+// showing a dead middle or low model runs MR::calcAnimDirect on it
+bool LodCtrl::isExpensiveToShow(s32 level) const {
+    switch (level) {
+    case 1:
+        return MR::isDead(_10);
+    case 2:
+        return MR::isDead(_14);
+    default:
+        return false;
+    }
+}
+
+void LodCtrl::showLodModel(s32 level) {
+    switch (level) {
+    case 0:
+        showHighModel();
+        break;
+    case 1:
+        showMiddleModel();
+        break;
+    case 2:
+        showLowModel();
+        break;
+    default:
+        hideAllModel();
+        break;
+    }
+}
+
+LodCtrlHolder::LodCtrlHolder(s32 ctrlNumMax) {
+    mHysteresisRate = 0.1f;
+    mExpensiveSwitchMax = 4;
+    mLodCtrls.init(ctrlNumMax);
+    mSwitchCtrls.init(ctrlNumMax);
+}
+
+// a control that does not fit keeps switching itself in LodCtrl::update
+void LodCtrlHolder::registerLodCtrl(LodCtrl *pCtrl) {
+    if (mLodCtrls.size() >= mLodCtrls.capacity()) {
+        return;
+    }
+
+    mLodCtrls.push_back(pCtrl);
+    pCtrl->mIsEntryHolder = true;
+}
+
+void LodCtrlHolder::update() {
+    mSwitchCtrls.clear();
+
+    for (s32 i = 0; i < mLodCtrls.size(); i++) {
+        LodCtrl* ctrl = mLodCtrls[i];
+
+        if (!ctrl->mIsRequestedUpdate) {
+            continue;
+        }
+
+        ctrl->mIsRequestedUpdate = false;
+
+        // invalidated since the request, the actor keeps its high model until validate
+        if (!ctrl->_18) {
+            continue;
+        }
+
+        s32 level = ctrl->calcRequestedLevel(mHysteresisRate);
+
+        if (level == ctrl->getLodLevel()) {
+            continue;
+        }
+
+        ctrl->mRequestedLevel = level;
+
+        s32 idx = mSwitchCtrls.size();
+        mSwitchCtrls.push_back(ctrl);
+
+        while (idx > 0 && mSwitchCtrls[idx - 1]->mDistanceToCamera > ctrl->mDistanceToCamera) {
+            mSwitchCtrls[idx] = mSwitchCtrls[idx - 1];
+            idx--;
+        }
+
+        mSwitchCtrls[idx] = ctrl;
+    }
+
+    // switches over the budget are requested again here so they are retried next frame
+    s32 expensiveNum = 0;
+
+    for (s32 i = 0; i < mSwitchCtrls.size(); i++) {
+        LodCtrl* ctrl = mSwitchCtrls[i];
+
+        if (ctrl->isExpensiveToShow(ctrl->mRequestedLevel)) {
+            if (expensiveNum >= mExpensiveSwitchMax) {
+                ctrl->mIsRequestedUpdate = true;
+                continue;
+            }
+
+            expensiveNum++;
+        }
+
+        ctrl->showLodModel(ctrl->mRequestedLevel);
+    }
+}
+
 bool LodCtrlFunction::isExistLodLowModel(const char *pName) {
     char buf[0x100];
     snprintf(buf, sizeof(buf), "/ObjectData/%sLow.arc", pName);
@@ -1,6 +1,21 @@
 #include "Game/LiveActor/ModelManager.hpp"
 #include "Game/LiveActor/DisplayListMaker.hpp"
 #include "Game/Animation/XanimePlayer.hpp"
+#include <JSystem/JKernel/JKRHeap.hpp>
+
+ModelManager::ModelManager() {
+    mBtkPlayer = nullptr;
+    mBrkPlayer = nullptr;
+    mBtpPlayer = nullptr;
+    mBpkPlayer = nullptr;
+    mBvaPlayer = nullptr;
+    mResourceTable = nullptr;
+    mXanimePlayer = nullptr;
+    mModel = nullptr;
+    mModelResourceHolder = nullptr;
+    mDisplayListMaker = nullptr;
+    mDifferedDLHeap = nullptr;
+}
 
 void ModelManager::update() {
     XanimePlayer* player = mXanimePlayer;
@@ -46,6 +61,21 @@ void ModelManager::entry() {
 
 void ModelManager::newDifferedDLBuffer() {
     mDisplayListMaker->newDifferedDisplayList();
+    mDifferedDLHeap = nullptr;
+}
+
+// instances keep drawing from the shared material display lists until a material animation actually starts.
+// the buffer is later built on the heap that holds this manager, not on whichever heap is current then
+void ModelManager::requestDifferedDLBuffer() {
+    mDifferedDLHeap = JKRHeap::findFromRoot(this);
+}
+
+void ModelManager::tryNewDifferedDLBuffer() {
+    if (mDifferedDLHeap != nullptr) {
+        JKRHeap* pPrevHeap = mDifferedDLHeap->becomeCurrentHeap();
+        newDifferedDLBuffer();
+        pPrevHeap->becomeCurrentHeap();
+    }
 }
 
 // ModelManager::updateDL
@@ -64,24 +94,28 @@ void ModelManager::startBckWithInterpole(const char *pAnimName, s32 interpole) {
 
 void ModelManager::startBtk(const char *pBtkName) {
     stopBtk();
+    tryNewDifferedDLBuffer();
     mBtkPlayer->start(pBtkName);
     mDisplayListMaker->onCurFlagBtk(reinterpret_cast<const J3DAnmBase*>(mBtkPlayer->mData));
 }
 
 void ModelManager::startBrk(const char *pBrkName) {
     stopBrk();
+    tryNewDifferedDLBuffer();
     mBrkPlayer->start(pBrkName);
     mDisplayListMaker->onCurFlagBrk(reinterpret_cast<const J3DAnmBase*>(mBrkPlayer->mData));
 }
 
 void ModelManager::startBtp(const char *pBtpName) {
     stopBtp();
+    tryNewDifferedDLBuffer();
     mBtpPlayer->start(pBtpName);
     mDisplayListMaker->onCurFlagBtp(reinterpret_cast<const J3DAnmBase*>(mBtpPlayer->mData));
 }
 
 void ModelManager::startBpk(const char *pBpkName) {
     stopBpk();
+    tryNewDifferedDLBuffer();
     mBpkPlayer->start(pBpkName);
     mDisplayListMaker->onCurFlagBpk(reinterpret_cast<const J3DAnmBase*>(mBpkPlayer->mData));
 }
@@ -1,10 +1,51 @@
 #include "Game/LiveActor/ShadowController.hpp"
 #include "Game/LiveActor/ShadowDrawer.hpp"
+#include "Game/LiveActor/Binder.hpp"
+#include "Game/Map/CollisionParts.hpp"
+#include "Game/Util/HashUtil.hpp"
+
+namespace {
+    // a host standing still on static ground still gets its shadow recast this often
+    const u32 cDropCacheAgeMax = 8;
+    const f32 cDropCacheDistance = 1.0f;
+    // slots looked at before a controller gives up on the table and just updates every time
+    const u32 cDropCacheProbeMax = 0x10;
+
+    // the shadow of a host standing on ground lands on that ground, so the drop can only be reused while
+    // those parts hold still. floating hosts don't know what their ray hits and always recast
+    bool isHostOnStaticGround(const LiveActor *pHost) {
+        if (pHost->mBinder == nullptr || !MR::isBindedGround(pHost)) {
+            return false;
+        }
+
+        const CollisionParts* pParts = pHost->mBinder->mFloorInfo.mParentTriangle.mParts;
+
+        if (pParts == nullptr) {
+            return false;
+        }
+
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 4; j++) {
+                if (pParts->mBaseMatrix.mMtx[i][j] != pParts->mPrevBaseMatrix.mMtx[i][j]) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+};
 
 ShadowControllerHolder::ShadowControllerHolder() : NameObj("影管理"), _C(), _18(), _24(false) {
     mFarClip = 4000.0f;
     _C.init(0x500);
     _18.init(0x400);
+    mDropCache = new ShadowDropCache[SHADOW_DROP_CACHE_SIZE];
+
+    for (u32 i = 0; i < SHADOW_DROP_CACHE_SIZE; i++) {
+        mDropCache[i].mController = nullptr;
+    }
+
     MR::connectToScene(this, 0x2D, -1, -1, -1);
 
     if (MR::isEqualStageName("AstroGalaxy") || MR::isEqualStageName("PeachCastleGardenGalaxy") || MR::isEqualStageName("PeachCastleFinalGalaxy")) {
@@ -36,12 +77,88 @@ void ShadowControllerHolder::updateController() {
             _18[i]->updateFarClipping(mFarClip);
         }
 
-        _18[i]->update();
+        ShadowController* pController = _18[i];
+        ShadowDropCache* pCache = findDropCache(pController);
+
+        if (pCache != nullptr && isReuseDropCache(pController, pCache)) {
+            pCache->mAge++;
+            pController->_64 = 0;
+            continue;
+        }
+
+        pController->update();
+
+        if (pCache != nullptr) {
+            updateDropCache(pController, pCache);
+        }
     }
 
     _18.clear();
 }
 
+// returns nullptr when the probe runs out of slots, those controllers just update every time
+ShadowDropCache* ShadowControllerHolder::findDropCache(const ShadowController *pController) {
+    HashProbe probe(MR::getPointerHashCode(pController), SHADOW_DROP_CACHE_SIZE, cDropCacheProbeMax);
+
+    do {
+        ShadowDropCache* pCache = &mDropCache[probe.getSlot()];
+
+        if (pCache->mController == pController) {
+            return pCache;
+        }
+
+        if (pCache->mController == nullptr) {
+            pCache->mController = pController;
+            pCache->mAge = cDropCacheAgeMax;
+            return pCache;
+        }
+    } while (probe.next());
+
+    return nullptr;
+}
+
+// one-time requests, hidden shadows and hosts that are not resting on static ground always go through update
+bool ShadowControllerHolder::isReuseDropCache(const ShadowController *pController, ShadowDropCache *pCache) const {
+    if (pCache->mAge >= cDropCacheAgeMax) {
+        return false;
+    }
+
+    if (pController->_60 == 2 || pController->_61 == 2 || pController->_61 == 5) {
+        return false;
+    }
+
+    if (!pController->isDraw()) {
+        return false;
+    }
+
+    if (!isHostOnStaticGround(pController->mActor)) {
+        return false;
+    }
+
+    TVec3f dropPos;
+    pController->getDropPos(&dropPos);
+
+    if (dropPos.squared(pCache->mDropPos) > cDropCacheDistance * cDropCacheDistance) {
+        return false;
+    }
+
+    TVec3f dropDir;
+    pController->getDropDir(&dropDir);
+
+    return dropDir.x == pCache->mDropDir.x && dropDir.y == pCache->mDropDir.y && dropDir.z == pCache->mDropDir.z;
+}
+
+void ShadowControllerHolder::updateDropCache(const ShadowController *pController, ShadowDropCache *pCache) {
+    if (!pController->isDraw()) {
+        pCache->mAge = cDropCacheAgeMax;
+        return;
+    }
+
+    pController->getDropPos(&pCache->mDropPos);
+    pController->getDropDir(&pCache->mDropDir);
+    pCache->mAge = 0;
+}
+
 ShadowControllerList::ShadowControllerList(LiveActor *pActor, u32 listCount) : mShadowList(), mHost(pActor) {
     mShadowList.init(listCount);
 }
@@ -64,6 +64,7 @@ void BezierRailPart::set(const TVec3f &a1, const TVec3f &a2, const TVec3f &a3, c
     _24 = v16;
 
     mLength = getLength(0.0f, 1.0f, 0xA);
+    initArcLengthTable();
 }
 
 void BezierRailPart::calcPos(TVec3f *pOut, f32 a2) const {
@@ -100,9 +101,170 @@ void BezierRailPart::calcVelocity(TVec3f *pOut, f32 a2) const {
     pOut->scale(3.0f);
 }
 
-// BezierRailPart::getLength
-// BezierRailPart::getParam
-// BezierRailPart::getNearestParam
+// Simpson's rule over stepNum pairs of intervals
+f32 BezierRailPart::getLength(f32 start, f32 end, int stepNum) const {
+    f32 step = (end - start) / (2 * stepNum);
+    TVec3f velocity;
+
+    calcVelocity(&velocity, start);
+    f32 sum = PSVECMag(&velocity);
+    calcVelocity(&velocity, end);
+    sum += PSVECMag(&velocity);
+
+    for (int i = 1; i < 2 * stepNum; i++) {
+        calcVelocity(&velocity, start + step * i);
+        sum += ((i & 1) ? 4.0f : 2.0f) * PSVECMag(&velocity);
+    }
+
+    return sum * step / 3.0f;
+}
+
+// binary search in the table, interpolation, then one newton step inside the section
+f32 BezierRailPart::getParam(f32 coord) const {
+    if (coord <= 0.0f) {
+        return 0.0f;
+    }
+
+    if (coord >= mLength) {
+        return 1.0f;
+    }
+
+    s32 low = 0;
+    s32 high = BEZIER_RAIL_PART_TABLE_NUM;
+
+    while (high - low > 1) {
+        s32 middle = (low + high) / 2;
+
+        if (mArcLengths[middle] <= coord) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    f32 step = 1.0f / BEZIER_RAIL_PART_TABLE_NUM;
+    f32 start = step * low;
+    f32 sectionLength = mArcLengths[high] - mArcLengths[low];
+    f32 param = start;
+
+    if (sectionLength > 0.0f) {
+        param += step * ((coord - mArcLengths[low]) / sectionLength);
+    }
+
+    TVec3f velocity;
+    calcVelocity(&velocity, param);
+    f32 speed = PSVECMag(&velocity);
+
+    if (speed > 0.001f) {
+        param -= (mArcLengths[low] + getLength(start, param, 2) - coord) / speed;
+        param = MR::clamp(param, start, start + step);
+    }
+
+    return param;
+}
+
+f32 BezierRailPart::getCoord(f32 param) const {
+    s32 index = param * BEZIER_RAIL_PART_TABLE_NUM;
+
+    if (index < 0) {
+        index = 0;
+    }
+    else if (index >= BEZIER_RAIL_PART_TABLE_NUM) {
+        index = BEZIER_RAIL_PART_TABLE_NUM - 1;
+    }
+
+    f32 start = static_cast<f32>(index) / BEZIER_RAIL_PART_TABLE_NUM;
+    return mArcLengths[index] + getLength(start, param, 2);
+}
+
+// scaled so the last entry is exactly mLength
+void BezierRailPart::initArcLengthTable() {
+    f32 step = 1.0f / BEZIER_RAIL_PART_TABLE_NUM;
+    mArcLengths[0] = 0.0f;
+
+    for (s32 i = 0; i < BEZIER_RAIL_PART_TABLE_NUM; i++) {
+        mArcLengths[i + 1] = mArcLengths[i] + getLength(step * i, step * (i + 1), 2);
+    }
+
+    f32 total = mArcLengths[BEZIER_RAIL_PART_TABLE_NUM];
+
+    if (total > 0.0f) {
+        for (s32 i = 1; i <= BEZIER_RAIL_PART_TABLE_NUM; i++) {
+            mArcLengths[i] *= mLength / total;
+        }
+    }
+}
+
+// the control points of the curve bound it
+void BezierRailPart::calcBounds(TVec3f *pMin, TVec3f *pMax) const {
+    TVec3f points[4];
+    points[0] = _0;
+    points[1] = _0;
+    points[1].add(_C);
+    points[2] = _18;
+    points[2].add(points[1]);
+    points[2].add(points[1]);
+    points[2].sub(_0);
+    points[3] = _24;
+    points[3].add(points[2] * 3.0f);
+    points[3].sub(points[1] * 3.0f);
+    points[3].add(_0);
+
+    pMin->set<f32>(points[0]);
+    pMax->set<f32>(points[0]);
+
+    for (s32 i = 1; i < 4; i++) {
+        pMin->x = points[i].x < pMin->x ? points[i].x : pMin->x;
+        pMin->y = points[i].y < pMin->y ? points[i].y : pMin->y;
+        pMin->z = points[i].z < pMin->z ? points[i].z : pMin->z;
+        pMax->x = points[i].x > pMax->x ? points[i].x : pMax->x;
+        pMax->y = points[i].y > pMax->y ? points[i].y : pMax->y;
+        pMax->z = points[i].z > pMax->z ? points[i].z : pMax->z;
+    }
+}
+
+// samples every step, then halves the step around the nearest sample
+f32 BezierRailPart::getNearestParam(const TVec3f &rPos, f32 step) const {
+    TVec3f pos;
+    calcPos(&pos, 0.0f);
+    pos.sub(rPos);
+
+    f32 nearestParam = 0.0f;
+    f32 nearestDist = pos.squared();
+
+    for (f32 param = step; param < 1.0f + step; param += step) {
+        f32 curParam = param < 1.0f ? param : 1.0f;
+        calcPos(&pos, curParam);
+        pos.sub(rPos);
+        f32 curDist = pos.squared();
+
+        if (curDist < nearestDist) {
+            nearestDist = curDist;
+            nearestParam = curParam;
+        }
+    }
+
+    for (s32 i = 0; i < 4; i++) {
+        step *= 0.5f;
+        f32 center = nearestParam;
+
+        for (s32 sign = -1; sign <= 1; sign += 2) {
+            f32 curParam = MR::clamp(center + step * sign, 0.0f, 1.0f);
+            calcPos(&pos, curParam);
+            pos.sub(rPos);
+            f32 curDist = pos.squared();
+
+            if (curDist < nearestDist) {
+                nearestDist = curDist;
+                nearestParam = curParam;
+            }
+        }
+    }
+
+    return nearestParam;
+}
+
 // BezierRail::normalizePos
 
 f32 BezierRail::getTotalLength() const {
@@ -139,8 +301,7 @@ void BezierRail::calcPosDir(TVec3f *pPos, TVec3f *pDir, f32 a3) const {
     calcRailDirection(pDir, part, val);
 }
 
-#ifdef NON_MATCHING
-// regalloc issues
+// parts whose bounds are already farther than the nearest position are skipped
 f32 BezierRail::getNearestRailPosCoord(const TVec3f &a1) const {
     RailPart* part = mRailParts;
     int idx = 0;
@@ -157,6 +318,10 @@ f32 BezierRail::getNearestRailPosCoord(const TVec3f &a1) const {
     for (int i = 1; i < _8; i++) {
         RailPart* curPart = &mRailParts[i];
 
+        if (curPart->calcBoundsDistanceSquared(a1) >= sqrt) {
+            continue;
+        }
+
         f32 curPartLength = curPart->getTotalLength();
         f32 curNearParam = curPart->getNearestParam(a1, 100.0f / curPartLength);
         curPart->calcPos(&pos, curNearParam);
@@ -172,9 +337,8 @@ f32 BezierRail::getNearestRailPosCoord(const TVec3f &a1) const {
     }
 
     f32 val = !idx ? 0.0f : _10[idx - 1];
-    return (val + mRailParts[idx].getLength(0.0f, nearestParam, 10));
+    return (val + mRailParts[idx].getCoord(nearestParam));
 }
-#endif
 
 f32 BezierRail::getRailPosCoord(int idx) const {
     if (!idx) {
@@ -2,6 +2,21 @@
 
 #include "JSystem/JMath/JMath.hpp"
 
+namespace {
+    void extendBounds(TVec3f *pMin, TVec3f *pMax, const TVec3f &rPos) {
+        pMin->x = rPos.x < pMin->x ? rPos.x : pMin->x;
+        pMin->y = rPos.y < pMin->y ? rPos.y : pMin->y;
+        pMin->z = rPos.z < pMin->z ? rPos.z : pMin->z;
+        pMax->x = rPos.x > pMax->x ? rPos.x : pMax->x;
+        pMax->y = rPos.y > pMax->y ? rPos.y : pMax->y;
+        pMax->z = rPos.z > pMax->z ? rPos.z : pMax->z;
+    }
+
+    f32 clampAxis(f32 value, f32 min, f32 max) {
+        return value < min ? min : (value > max ? max : value);
+    }
+};
+
 RailPart::RailPart()
     : mRailPartLinear(0), mRailPartBezier(0) {
 }
@@ -10,6 +25,12 @@ void RailPart::init(const TVec3f &a1, const TVec3f &a2, const TVec3f &a3, const
     if ((!a1.epsilonEquals(a2, 0.1f)) || (a4.epsilonEquals(a3, 0.1f))) {
         mRailPartLinear = new LinearRailPart();
         mRailPartLinear->set(a1, a4);       
+
+        TVec3f end;
+        calcPos(&end, 1.0f);
+        mBoundsMin.set<f32>(a1);
+        mBoundsMax.set<f32>(a1);
+        extendBounds(&mBoundsMin, &mBoundsMax, end);
     }
     else {
         initForBezier(a1, a2, a3, a4);
@@ -19,6 +40,7 @@ void RailPart::init(const TVec3f &a1, const TVec3f &a2, const TVec3f &a3, const
 void RailPart::initForBezier(const TVec3f &a1, const TVec3f &a2, const TVec3f &a3, const TVec3f &a4) {
     mRailPartBezier = new BezierRailPart();
     mRailPartBezier->set(a1, a2, a3, a4);
+    mRailPartBezier->calcBounds(&mBoundsMin, &mBoundsMax);
 }
 
 void RailPart::calcPos(TVec3f *pOut, f32 a2) const {
@@ -63,6 +85,23 @@ f32 RailPart::getParam(f32 a1) const {
     return mRailPartBezier->getParam(a1);
 }
 
+f32 RailPart::getCoord(f32 param) const {
+    if (mRailPartLinear) {
+        return (mRailPartLinear->_18 * param);
+    }
+
+    return mRailPartBezier->getCoord(param);
+}
+
+// no point of this part is closer to rPos than this
+f32 RailPart::calcBoundsDistanceSquared(const TVec3f &rPos) const {
+    TVec3f clamped;
+    clamped.x = clampAxis(rPos.x, mBoundsMin.x, mBoundsMax.x) - rPos.x;
+    clamped.y = clampAxis(rPos.y, mBoundsMin.y, mBoundsMax.y) - rPos.y;
+    clamped.z = clampAxis(rPos.z, mBoundsMin.z, mBoundsMax.z) - rPos.z;
+    return clamped.squared();
+}
+
 f32 RailPart::getNearestParam(const TVec3f &rPos, f32 a2) const {
     if (mRailPartLinear) {
         return mRailPartLinear->getNearestParam(rPos, a2);
@@ -30,6 +30,7 @@ ZoneSwitch::ZoneSwitch() : BitFlag128() {
 
 SwitchIdInfo::SwitchIdInfo(s32 switchID, const JMapInfoIter &rIter) {
     mIDInfo = nullptr;
+    mSwitch = nullptr;
     mIsGlobal = switchID >= 1000;
     mIDInfo = new JMapIdInfo(switchID, rIter);
 }
@@ -52,6 +53,10 @@ void StageSwitchContainer::createAndAddZone(const SwitchIdInfo &rInfo) {
     sw.mData = rInfo.mIDInfo->mZoneID;
     sw.mSwitch = s;
     mSwitches.push_back(sw);
+
+    if (sw.mData >= 0 && sw.mData < STAGE_SWITCH_ZONE_TABLE_SIZE) {
+        mZoneSwitchTable[sw.mData] = s;
+    }
 }
 
 ZoneSwitch* StageSwitchContainer::getZoneSwitch(const SwitchIdInfo &rInfo) {
@@ -63,6 +68,12 @@ ZoneSwitch* StageSwitchContainer::getZoneSwitch(const SwitchIdInfo &rInfo) {
 }
 
 ZoneSwitch* StageSwitchContainer::findZoneSwitchFromTable(const SwitchIdInfo &rInfo) {
+    s32 zoneID = rInfo.mIDInfo->mZoneID;
+
+    if (zoneID >= 0 && zoneID < STAGE_SWITCH_ZONE_TABLE_SIZE) {
+        return mZoneSwitchTable[zoneID];
+    }
+
     for (int i = 0; i < mSwitches.size(); i++) {
         ContainerSwitch* pContainer = &mSwitches[i];
 
@@ -158,12 +169,13 @@ SwitchIdInfo* StageSwitchFunction::createSwitchIdInfo(const char *pSwitchName, c
 
     SwitchIdInfo* inf = new SwitchIdInfo(switchNo, rIter);
 
-    if (switchNo < 0x3E8) {
-        StageSwitchContainer* pContainer = MR::getSceneObj<StageSwitchContainer*>(SceneObj_StageSwitchContainer);
+    StageSwitchContainer* pContainer = MR::getSceneObj<StageSwitchContainer*>(SceneObj_StageSwitchContainer);
 
+    if (switchNo < 0x3E8) {
         pContainer->createAndAddZone(*inf); 
     }
 
+    inf->mSwitch = pContainer->getZoneSwitch(*inf);
     return inf;
 }
 
@@ -171,7 +183,11 @@ void StageSwitchFunction::onSwitchBySwitchIdInfo(const SwitchIdInfo &rSwitchId)
     s32 switchNo = rSwitchId.getSwitchNo();
     StageSwitchContainer* pContainer = MR::getSceneObj<StageSwitchContainer*>(SceneObj_StageSwitchContainer);
 
-    ZoneSwitch* pZoneSwitch = pContainer->getZoneSwitch(rSwitchId);
+    ZoneSwitch* pZoneSwitch = rSwitchId.mSwitch;
+
+    if (pZoneSwitch == nullptr) {
+        pZoneSwitch = pContainer->getZoneSwitch(rSwitchId);
+    }
 
     if (!pZoneSwitch->get(switchNo)) {
         pZoneSwitch->set(switchNo, true);
@@ -182,7 +198,11 @@ void StageSwitchFunction::offSwitchBySwitchIdInfo(const SwitchIdInfo &rSwitchId)
     s32 switchNo = rSwitchId.getSwitchNo();
     StageSwitchContainer* pContainer = MR::getSceneObj<StageSwitchContainer*>(SceneObj_StageSwitchContainer);
 
-    ZoneSwitch* pZoneSwitch = pContainer->getZoneSwitch(rSwitchId);
+    ZoneSwitch* pZoneSwitch = rSwitchId.mSwitch;
+
+    if (pZoneSwitch == nullptr) {
+        pZoneSwitch = pContainer->getZoneSwitch(rSwitchId);
+    }
 
     if (pZoneSwitch->get(switchNo)) {
         pZoneSwitch->set(switchNo, false);
@@ -191,9 +211,12 @@ void StageSwitchFunction::offSwitchBySwitchIdInfo(const SwitchIdInfo &rSwitchId)
 
 bool StageSwitchFunction::isOnSwitchBySwitchIdInfo(const SwitchIdInfo &rSwitchId) {
     s32 switchNo = rSwitchId.getSwitchNo();
-    StageSwitchContainer* pContainer = MR::getSceneObj<StageSwitchContainer*>(SceneObj_StageSwitchContainer);
+    ZoneSwitch* pZoneSwitch = rSwitchId.mSwitch;
 
-    ZoneSwitch* pZoneSwitch = pContainer->getZoneSwitch(rSwitchId);
+    if (pZoneSwitch == nullptr) {
+        StageSwitchContainer* pContainer = MR::getSceneObj<StageSwitchContainer*>(SceneObj_StageSwitchContainer);
+        pZoneSwitch = pContainer->getZoneSwitch(rSwitchId);
+    }
 
     return pZoneSwitch->get(switchNo);
 }
@@ -214,6 +237,10 @@ StageSwitchContainer::StageSwitchContainer() :
     mGlobalSwitches()
 {
     mGlobalSwitches = new ZoneSwitch();
+
+    for (s32 i = 0; i < STAGE_SWITCH_ZONE_TABLE_SIZE; i++) {
+        mZoneSwitchTable[i] = nullptr;
+    }
 }
 
 StageSwitchCtrl::StageSwitchCtrl(const JMapInfoIter &rIter) :
@@ -1,6 +1,15 @@
 #include "Game/NameObj/NameObjFactory.hpp"
 #include "Game/Map/PlanetMapCreator.hpp"
 #include "Game/Util.hpp"
+#include "Game/Util/HashUtil.hpp"
+
+namespace {
+    const u32 cCreateFuncIndexSize = 0x800;
+
+    // entries of cCreateTable by case-folded name hash, the names are static so they need no interning
+    s16 sCreateFuncIndex[cCreateFuncIndexSize];
+    bool sIsValidCreateFuncIndex = false;
+};
 
 CreationFuncPtr NameObjFactory::getCreator(const char *pName) {
     if (PlanetMapCreatorFunction::isRegisteredObj(pName)) {
@@ -45,7 +54,25 @@ bool NameObjFactory::isPlayerArchiveLoaderObj(const char *pArchive) {
 
 const NameObjFactory::Name2CreateFunc* NameObjFactory::getName2CreateFunc(const char *pName, const NameObjFactory::Name2CreateFunc *pTable) {
     if (!pTable) {
-        pTable = cCreateTable;
+        if (!sIsValidCreateFuncIndex) {
+            initCreateFuncIndex();
+        }
+
+        HashProbe probe(MR::getMixedHashCode(MR::getHashCodeLower(pName)), cCreateFuncIndexSize, cCreateFuncIndexSize);
+
+        while (sCreateFuncIndex[probe.getSlot()] >= 0) {
+            const Name2CreateFunc* func = &cCreateTable[sCreateFuncIndex[probe.getSlot()]];
+
+            if (MR::isEqualStringCase(func->mName, pName)) {
+                return func;
+            }
+
+            if (!probe.next()) {
+                break;
+            }
+        }
+
+        return 0;
     }
 
 
@@ -62,6 +89,36 @@ const NameObjFactory::Name2CreateFunc* NameObjFactory::getName2CreateFunc(const
     return 0;
 }
 
+// keeps the first of equal names, like the scan
+void NameObjFactory::initCreateFuncIndex() {
+    for (u32 i = 0; i < cCreateFuncIndexSize; i++) {
+        sCreateFuncIndex[i] = -1;
+    }
+
+    for (s32 i = 0; i < 0x49F; i++) {
+        const char* pName = cCreateTable[i].mName;
+
+        if (!pName) {
+            continue;
+        }
+
+        // the index has more than twice as many slots as the table has entries, so the probe never runs out
+        HashProbe probe(MR::getMixedHashCode(MR::getHashCodeLower(pName)), cCreateFuncIndexSize, cCreateFuncIndexSize);
+
+        while (sCreateFuncIndex[probe.getSlot()] >= 0 && !MR::isEqualStringCase(cCreateTable[sCreateFuncIndex[probe.getSlot()]].mName, pName)) {
+            if (!probe.next()) {
+                break;
+            }
+        }
+
+        if (sCreateFuncIndex[probe.getSlot()] < 0) {
+            sCreateFuncIndex[probe.getSlot()] = i;
+        }
+    }
+
+    sIsValidCreateFuncIndex = true;
+}
+
 void NameObjFactory::getMountObjectArchiveList(NameObjArchiveListCollector *pArchiveList, const char *pName, const JMapInfoIter &rIter) {
     if (PlanetMapCreatorFunction::isRegisteredObj(pName)) {
         PlanetMapCreatorFunction::makeArchiveList(pArchiveList, rIter, pName);
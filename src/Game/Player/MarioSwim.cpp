@@ -235,6 +235,7 @@ MarioSwim::MarioSwim(MarioActor *actor) : MarioState(actor, 6), _F4()
     _1B2 = 0;
     _1B4 = 0.0f;
     _1B8 = 0.0f;
+    MR::initAreaObjQueryResult(&mWaterAreaQuery, 1);
     _14 = new MarineSnow();
 }
 
@@ -1019,7 +1020,7 @@ bool MarioSwim::update()
         }
     }
     else if (_19) {
-        AreaObj *obj = MR::getAreaObj("WaterArea", getTrans().translate(getGravityVec() % 100f));
+        AreaObj *obj = MR::findAreaObj("WaterArea", getTrans().translate(getGravityVec() % 100f), &mWaterAreaQuery);
         if (obj) {
             TPos3f *followMtx = obj->getFollowMtx();
             if (followMtx) {
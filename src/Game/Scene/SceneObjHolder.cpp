@@ -1,4 +1,5 @@
 #include "Game/Scene/SceneObjHolder.hpp"
+#include "Game/Animation/XanimeCore.hpp"
 #include "Game/NameObj/NameObj.hpp"
 #include "Game/System/GameSystem.hpp"
 #include "Game/System/GameSystemSceneController.hpp"
@@ -128,6 +129,8 @@ SceneObjHolder::SceneObjHolder() {
     for (int i = 0; i < SceneObj_COUNT; i++) {
         mObj[i] = NULL;
     }
+
+    XanimeCore::clearSampleCache();
 }
 
 NameObj* SceneObjHolder::create(int id) {
@@ -11,6 +11,21 @@ JMapInfoIter JMapInfo::end() const {
 }
 
 namespace {
+    // placement tables are read field by field for every object they place, so they get the decoded view
+    static u32 createDecodedViews(MR::AssignableArray<JMapInfo> *pInfoArray) NO_INLINE {
+        u32 size = 0;
+
+        for (JMapInfo* pInfo = pInfoArray->mArr; pInfo != pInfoArray->end(); pInfo++) {
+            size += pInfo->createDecodedView();
+        }
+
+        return size;
+    }
+
+    static void reportDecodedViewSize(const char *pTableName, s32 zoneID, u32 size) NO_INLINE {
+        OSReport("StageDataHolder: %s of zone %d decoded, 0x%x bytes (0x%x bytes in all)\n", pTableName, zoneID, size, JMapInfo::getDecodedViewTotalSize());
+    }
+
     static bool isPrioPlacementObjInfo(const char *pName) NO_INLINE {
         return MR::isEqualStringCase(pName, "AreaObjInfo") 
             || MR::isEqualStringCase(pName, "PlanetObjInfo")
@@ -70,6 +85,7 @@ void StageDataHolder::init(const JMapInfoIter &rIter) {
     if (_E0) {
         u32 commonLayer = ScenarioDataFunction::getCurrentCommonLayers(_A8);
         initLayerJmpInfo(&_EC, "/jmp/Placement", "/jmp/MapParts", commonLayer);
+        ::reportDecodedViewSize("common placement", mZoneID, ::createDecodedViews(&_EC));
     }
 
     createLocalStageDataHolder(_EC, 1);
@@ -120,6 +136,11 @@ void StageDataHolder::initAfterScenarioSelected() {
     initJmpInfo(&mListObjs, "/jmp/List");
     initJmpInfo(&mPathObjs, "/jmp/Path");
     calcDataAddress();
+
+    u32 decodedSize = ::createDecodedViews(&_F4);
+    decodedSize += ::createDecodedViews(&mPlacementObjs);
+    decodedSize += ::createDecodedViews(&mStartObjs);
+    ::reportDecodedViewSize("scenario placement", mZoneID, decodedSize);
 }
 
 void StageDataHolder::requestFileLoadCommon() {
@@ -275,6 +296,7 @@ void StageDataHolder::initTableData() {
 
     mObjNameTbl = new JMapInfo();
     mObjNameTbl->attach(tableFile);
+    ::reportDecodedViewSize("ObjNameTable", mZoneID, mObjNameTbl->createDecodedView());
 }
 
 void StageDataHolder::initPlacementInfoOrderedCommon() {
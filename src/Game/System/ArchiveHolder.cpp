@@ -1,5 +1,6 @@
 #include "Game/System/ArchiveHolder.hpp"
 #include "Game/Util.hpp"
+#include "Game/Util/HashUtil.hpp"
 #include <cstring>
 
 ArchiveHolderArchiveEntry::ArchiveHolderArchiveEntry(void *pData, JKRHeap *pHeap, const char *pName) {
@@ -13,6 +14,8 @@ ArchiveHolderArchiveEntry::ArchiveHolderArchiveEntry(void *pData, JKRHeap *pHeap
     char* name = new(pHeap, 0) char[len];
     mArchiveName = name;
     MR::copyString(mArchiveName, pName, len);
+    // set by ArchiveHolder::createAndAdd under its lock, so a reset of the intern table cannot come in between
+    mNameHandle = nullptr;
 }
 
 ArchiveHolderArchiveEntry::~ArchiveHolderArchiveEntry() {
@@ -33,6 +36,7 @@ ArchiveHolderArchiveEntry* ArchiveHolder::createAndAdd(void *pData, JKRHeap *pHe
     ArchiveHolderArchiveEntry* entry = new(pHeap, 0) ArchiveHolderArchiveEntry(pData, pHeap, pName);
     OSMutex* mutex = &mMutex;
     OSLockMutex(mutex);
+    entry->mNameHandle = MR::internString(entry->mArchiveName);
     s32 num = mCurEntryNum;
     mCurEntryNum = num + 1;
     mEntries[num] = entry;
@@ -56,12 +60,41 @@ void ArchiveHolder::getArchiveAndHeap(const char *pName, JKRArchive** pArchive,
 
 // void ArchiveHolder::removeIfIsEqualHeap(JKRHeap *pHeap)
 
+// empties the intern table and hands the entries still mounted new handles in one step under the lock,
+// so no entry is added or looked up with a handle of the old table
+void ArchiveHolder::resetNameHandles() {
+    OSMutex* mutex = &mMutex;
+    OSLockMutex(mutex);
+    MR::clearInternedStrings();
+
+    for (ArchiveHolderArchiveEntry** i = first(); i != last(); i++) {
+        (*i)->mNameHandle = MR::internString((*i)->mArchiveName);
+    }
+
+    OSUnlockMutex(mutex);
+}
+
 ArchiveHolderArchiveEntry* ArchiveHolder::findEntry(const char *pName) const {
+    OSMutex* mutex = const_cast<OSMutex*>(&mMutex);
+    OSLockMutex(mutex);
+    const char* pHandle = MR::findInternedString(pName);
+    ArchiveHolderArchiveEntry* pEntry = nullptr;
+
     for (ArchiveHolderArchiveEntry** i = first(); i != last(); i++) {
-        if (MR::isEqualStringCase((*i)->mArchiveName, pName)) {
-            return *i;
+        const char* pEntryHandle = (*i)->mNameHandle;
+
+        if (pEntryHandle != nullptr) {
+            if (pEntryHandle == pHandle) {
+                pEntry = *i;
+                break;
+            }
+        }
+        else if (MR::isEqualStringCase((*i)->mArchiveName, pName)) {
+            pEntry = *i;
+            break;
         }
     }
 
-    return nullptr;
+    OSUnlockMutex(mutex);
+    return pEntry;
 }
\ No newline at end of file
@@ -1,16 +1,104 @@
 #include "Game/System/DrawBufferGroup.hpp"
+#include "Game/Util/HashUtil.hpp"
+#include "JSystem/J3DGraphAnimator/J3DModel.hpp"
+#include "JSystem/J3DGraphAnimator/J3DModelData.hpp"
+#include "JSystem/J3DGraphBase/J3DMaterial.hpp"
 
 #include <algorithm>
 
+namespace {
+    struct ExecuterIndexEntry {
+        const DrawBufferGroup* mGroup;  // 0x0
+        u32 mHashCode;                  // 0x4, MR::getHashCode of the model name
+        s32 mIndex;                     // 0x8
+    };
+
+    const u32 cExecuterIndexTableSize = 0x400;
+    const u32 cExecuterIndexProbeMax = 0x10;
+
+    // one index for the groups of every DrawBufferHolder, keyed by group and model name
+    ExecuterIndexEntry sExecuterIndexTable[cExecuterIndexTableSize];
+    bool sIsExecuterIndexUsed = false;
+
+    u32 calcExecuterIndexHashCode(const DrawBufferGroup *pGroup, u32 nameHashCode) {
+        return MR::getPointerHashCode(pGroup) ^ MR::getMixedHashCode(nameHashCode);
+    }
+
+    void setExecuterIndexEntry(ExecuterIndexEntry *pEntry, const DrawBufferGroup *pGroup, u32 nameHashCode, s32 idx) {
+        pEntry->mGroup = pGroup;
+        pEntry->mHashCode = nameHashCode;
+        pEntry->mIndex = idx;
+        sIsExecuterIndexUsed = true;
+    }
+
+    // groups executers by the pixel engine state of their first material: block type, blend and z mode
+    u32 calcStateSortKey(const J3DModel *pModel) {
+        J3DMaterialTable& table = pModel->mModelData->mMaterialTable;
+
+        if (table.mMaterialCount == 0 || !table.mMaterials[0]->mPEBlock) {
+            return 0;
+        }
+
+        J3DPEBlock* peBlock = table.mMaterials[0]->mPEBlock;
+        u32 key = (peBlock->getType() & 0xFF) << 24;
+        J3DBlend* blend = peBlock->getBlend();
+
+        if (blend) {
+            key |= (blend->mType & 0xF) << 20 | (blend->mSrcFactor & 0xF) << 16 | (blend->mDstFactor & 0xF) << 12;
+        }
+
+        J3DZMode* zMode = peBlock->getZMode();
+
+        if (zMode) {
+            key |= zMode->_0 & 0xFFF;
+        }
+
+        return key;
+    }
+
+    // a model blends if any of its materials does, those go to the xlu buffers in the order they were entered
+    bool isOpaqueModel(const J3DModel *pModel) {
+        J3DMaterialTable& table = pModel->mModelData->mMaterialTable;
+
+        for (u16 i = 0; i < table.mMaterialCount; i++) {
+            J3DPEBlock* peBlock = table.mMaterials[i]->mPEBlock;
+
+            if (!peBlock) {
+                return false;
+            }
+
+            J3DBlend* blend = peBlock->getBlend();
+
+            if (blend && blend->mType != GX_BM_NONE) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
 DrawBufferGroup::DrawBufferGroup() : _0(), _C() {
     mCount = 0;
     _1C = -1;
     _20 = -1;
+    mIsSortedActive = true;
+    mIsOpaque = true;
 }
 
 void DrawBufferGroup::init(s32 count) {
     _0.init(count);
     _C.init(count);
+
+    // a holder inits all of its groups before anything registers, so this is the first group of a new
+    // scene and the entries of the last one can go. lookups check every hit, so this is only ever a cost
+    if (sIsExecuterIndexUsed) {
+        for (u32 i = 0; i < cExecuterIndexTableSize; i++) {
+            sExecuterIndexTable[i].mGroup = nullptr;
+        }
+
+        sIsExecuterIndexUsed = false;
+    }
 }
 
 s32 DrawBufferGroup::registerDrawBuffer(LiveActor *pActor) {
@@ -20,9 +108,15 @@ s32 DrawBufferGroup::registerDrawBuffer(LiveActor *pActor) {
     // executer does not exist
     if (idx < 0) {
         DrawBufferExecuter* exec = new DrawBufferExecuter(pModelName, MR::getJ3DModel(pActor), 0x10);
+        exec->mStateSortKey = calcStateSortKey(MR::getJ3DModel(pActor));
+
+        if (!isOpaqueModel(MR::getJ3DModel(pActor))) {
+            mIsOpaque = false;
+        }
 
         idx = _0.size();
         _0.push_back(exec);
+        addExecuterIndex(pModelName, idx);
 
         if (_20 == -1) {
             exec->onExecuteLight(_1C);
@@ -41,10 +135,26 @@ void DrawBufferGroup::active(LiveActor *pActor, s32 a2) {
 
     if (isEmpty) {
         _C.push_back(_0[a2]);
+        mIsSortedActive = false;
     }
 }
 
-// DrawBufferGroup::deactive
+// erase keeps the order of the rest, so a sorted list stays sorted and xlu entry order is kept
+void DrawBufferGroup::deactive(LiveActor *pActor, s32 a2) {
+    DrawBufferExecuter* exec = _0[a2];
+    exec->remove(pActor);
+
+    if (exec->_8 != 0) {
+        return;
+    }
+
+    for (s32 i = 0; i < _C.size(); i++) {
+        if (_C[i] == exec) {
+            _C.erase(&_C[i]);
+            break;
+        }
+    }
+}
 
 void DrawBufferGroup::findLightInfo(LiveActor *pActor, s32 a2) {
     MR::initActorLightInfoLightType(pActor, _1C);
@@ -61,12 +171,36 @@ void DrawBufferGroup::findLightInfo(LiveActor *pActor, s32 a2) {
     _0[a2]->offExecuteLight();
 }
 
-#ifdef NON_MATCHING
-// mem_fun doesn't get inlined...why? 
+// the active list only grows by appending, so an insertion sort stays close to linear.
+// groups holding a blending model keep the order executers became active in, since the xlu
+// buffers they enter are not z sorted and the submission order is what gets drawn
+void DrawBufferGroup::sortActiveExecuter() {
+    if (mIsSortedActive || !mIsOpaque) {
+        return;
+    }
+
+    for (s32 i = 1; i < _C.size(); i++) {
+        DrawBufferExecuter* exec = _C[i];
+        s32 j = i;
+
+        while (j > 0 && _C[j - 1]->mStateSortKey > exec->mStateSortKey) {
+            _C[j] = _C[j - 1];
+            j--;
+        }
+
+        _C[j] = exec;
+    }
+
+    mIsSortedActive = true;
+}
+
 void DrawBufferGroup::entry() {
-    for_each(_C.begin(), _C.end(), mem_fun(&DrawBufferExecuter::calcViewAndEntry));
+    sortActiveExecuter();
+
+    for (s32 i = 0; i < _C.size(); i++) {
+        _C[i]->calcViewAndEntry();
+    }
 }
-#endif
 
 // DrawBufferGroup::drawOpa
 // DrawBufferGroup::drawXlu
@@ -80,7 +214,26 @@ void DrawBufferGroup::setLightType(s32 type) {
     _20 = type;
 }
 
+// a group at the address of one from an earlier scene can meet its entries, so a hit is checked against
+// the executer. entries can also be lost to a full probe run, so a miss is confirmed by the scan
 s32 DrawBufferGroup::findExecuterIndex(const char *pName) const {
+    u32 nameHashCode = MR::getHashCode(pName);
+    HashProbe probe(calcExecuterIndexHashCode(this, nameHashCode), cExecuterIndexTableSize, cExecuterIndexProbeMax);
+
+    do {
+        const ExecuterIndexEntry* pEntry = &sExecuterIndexTable[probe.getSlot()];
+
+        if (pEntry->mGroup == nullptr) {
+            break;
+        }
+
+        if (pEntry->mGroup == this && pEntry->mHashCode == nameHashCode && pEntry->mIndex < _0.size()) {
+            if (MR::isEqualString(_0[pEntry->mIndex]->mName, pName)) {
+                return pEntry->mIndex;
+            }
+        }
+    } while (probe.next());
+
     for (u32 i = 0; i < _0.size(); i++) {
         if (MR::isEqualString(_0[i]->mName, pName)) {
             return i;
@@ -89,3 +242,21 @@ s32 DrawBufferGroup::findExecuterIndex(const char *pName) const {
 
     return -1;
 }
+
+// a full probe run replaces the entry in the home slot, no slot is ever emptied so every chain stays intact
+void DrawBufferGroup::addExecuterIndex(const char *pName, s32 idx) {
+    u32 nameHashCode = MR::getHashCode(pName);
+    HashProbe probe(calcExecuterIndexHashCode(this, nameHashCode), cExecuterIndexTableSize, cExecuterIndexProbeMax);
+    ExecuterIndexEntry* pHomeEntry = &sExecuterIndexTable[probe.getSlot()];
+
+    do {
+        ExecuterIndexEntry* pEntry = &sExecuterIndexTable[probe.getSlot()];
+
+        if (pEntry->mGroup == nullptr) {
+            setExecuterIndexEntry(pEntry, this, nameHashCode, idx);
+            return;
+        }
+    } while (probe.next());
+
+    setExecuterIndexEntry(pHomeEntry, this, nameHashCode, idx);
+}
@@ -1,4 +1,5 @@
 #include "Game/System/FileLoader.hpp"
+#include "Game/Util/HashUtil.hpp"
 #include "Game/Util/MemoryUtil.hpp"
 #include "Game/Util/StringUtil.hpp"
 #include <JSystem/JKernel/JKRExpHeap.hpp>
@@ -98,8 +99,14 @@ void FileLoader::getMountedArchiveAndHeap(const char* pName, JKRArchive** pArchi
     mArchiveHolder->getArchiveAndHeap(pName, pArchive, pHeap);
 }
 
+// names of earlier scenes would fill the intern arena, so it starts over with the archives still mounted.
+// the request lock keeps addRequest from interning a name into the table being emptied
 void FileLoader::clearRequestFileInfo(bool) {
+    OSMutex* mutex = &mMutex;
+    OSLockMutex(mutex);
     mRequestedFileCount = nullptr;
+    mArchiveHolder->resetNameHandles();
+    OSUnlockMutex(mutex);
 }
 
 void FileLoader::removeHolderIfIsEqualHeap(JKRHeap* pHeap) {
@@ -117,10 +124,17 @@ bool FileLoader::isNeedToLoad(const char* pName) const {
 }
 
 const RequestFileInfo* FileLoader::getRequestFileInfoConst(const char* pName) const {
+    const char* pHandle = MR::findInternedString(pName);
+
     for (u32 i = 0; i < mRequestedFileCount; i++) {
         RequestFileInfo* info = &mRequestFileInfos[i];
 
-        if (MR::isEqualStringCase(info->mFileName, pName)) {
+        if (info->mNameHandle != nullptr) {
+            if (info->mNameHandle == pHandle) {
+                return info;
+            }
+        }
+        else if (MR::isEqualStringCase(info->mFileName, pName)) {
             return info;
         }
     }
@@ -128,8 +142,6 @@ const RequestFileInfo* FileLoader::getRequestFileInfoConst(const char* pName) co
     return nullptr;
 }
 
-#ifdef NON_MATCHING
-// string load is in the wrong spot for some reason
 RequestFileInfo* FileLoader::addRequest(const char* pName) {
     OSMutex* mutex = &mMutex;
     OSLockMutex(mutex);
@@ -139,7 +151,7 @@ RequestFileInfo* FileLoader::addRequest(const char* pName) {
     info->mFileEntry = nullptr;
     info->_88 = 0;
     snprintf(info->mFileName, sizeof(info->mFileName), "%s", pName);
+    info->mNameHandle = MR::internString(info->mFileName);
     OSUnlockMutex(mutex);
     return info;
-}
-#endif
\ No newline at end of file
+}
\ No newline at end of file
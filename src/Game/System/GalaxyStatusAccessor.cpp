@@ -4,8 +4,11 @@
 #include "Game/System/ScenarioDataParser.hpp"
 #include "Game/Util.hpp"
 
+// the scenario and zone tables are walked by every star and layer query, so their fields get decoded once
 GalaxyStatusAccessor::GalaxyStatusAccessor(const ScenarioData *pScenarioData) {
     mScenarioData = pScenarioData;
+    mScenarioData->mScenarioData->createDecodedView();
+    mScenarioData->mZoneList->createDecodedView();
 }
 
 const char* GalaxyStatusAccessor::getName() const {
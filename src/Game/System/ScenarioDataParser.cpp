@@ -29,16 +29,13 @@ s32 ScenarioData::getZoneNum() const {
 }
 
 s32 ScenarioData::getZoneId(const char *pZoneName) const {
-    for (s32 i = 0; i < getZoneNum(); i++) {
-        const char* zoneName = 0;
-        mZoneList->getValue<const char *>(i, "ZoneName", &zoneName);
+    JMapInfoIter iter = MR::findJMapInfoElementNoCase(mZoneList, "ZoneName", pZoneName, 0);
 
-        if (MR::isEqualStringCase(zoneName, pZoneName)) {
-            return i;
-        }
+    if (iter == mZoneList->end()) {
+        return 0;
     }
 
-    return 0;
+    return iter.mIndex;
 }
 
 // ScenarioDataIter::isEnd()
@@ -21,6 +21,23 @@ namespace MR {
         return MR::getAreaObjContainer()->getAreaObj(pAreaName, rVec);
     }
 
+    void initAreaObjQueryResult(AreaObjQueryResult *pResults, s32 num) {
+        for (s32 i = 0; i < num; i++) {
+            pResults[i].mAreaObj = nullptr;
+            pResults[i].mIndex = -1;
+        }
+    }
+
+    void findAreaObjs(const char **pMgrNames, s32 mgrNum, const TVec3f *pPosArray, s32 posNum, AreaObjQueryResult *pResults) {
+        MR::getAreaObjContainer()->findAreaObjs(pMgrNames, mgrNum, pPosArray, posNum, pResults);
+    }
+
+    // same result as getAreaObj, for callers querying one position every frame
+    AreaObj* findAreaObj(const char *pMgrName, const TVec3f &rPos, AreaObjQueryResult *pResult) {
+        MR::getAreaObjContainer()->findAreaObjs(&pMgrName, 1, &rPos, 1, pResult);
+        return pResult->mAreaObj;
+    }
+
     s32 getAreaObjArg(const AreaObj *pObj, s32 which) {
         switch (which) {
             case 0:
@@ -1,6 +1,32 @@
 #pragma once
 
 #include "Game/Util/HashUtil.hpp"
+#include "Game/Util/StringUtil.hpp"
+#include <cstring>
+
+namespace {
+    const u32 cInternTableSize = 0x800;
+    const u32 cInternArenaSize = 0x8000;
+
+    // static storage, so handles outlive every scene heap
+    const char* sInternTable[cInternTableSize];
+    char sInternArena[cInternArenaSize];
+    u32 sInternArenaUsed = 0;
+    u32 sInternNum = 0;
+
+    // the table is kept at most half full, so the probe always ends on a match or an empty slot
+    u32 findInternSlot(const char *pStr) {
+        HashProbe probe(MR::getMixedHashCode(MR::getHashCodeLower(pStr)), cInternTableSize, cInternTableSize);
+
+        while (sInternTable[probe.getSlot()] != nullptr && !MR::isEqualStringCase(sInternTable[probe.getSlot()], pStr)) {
+            if (!probe.next()) {
+                break;
+            }
+        }
+
+        return probe.getSlot();
+    }
+};
 
 HashSortTable::HashSortTable(u32 cnt) {
     mHashCodes = new u32[cnt];
@@ -62,4 +88,65 @@ namespace MR {
         return val;
     }
 
+    // one lower-cased copy per name ignoring case, so two handles are equal exactly when isEqualStringCase is
+    // returns nullptr once the table or arena is full, callers then compare the strings themselves
+    const char* internString(const char *pStr) {
+        BOOL inter = OSDisableInterrupts();
+        u32 slot = findInternSlot(pStr);
+        const char* pHandle = sInternTable[slot];
+
+        if (pHandle == nullptr) {
+            u32 len = strlen(pStr) + 1;
+
+            if (sInternNum < cInternTableSize / 2 && sInternArenaUsed + len <= cInternArenaSize) {
+                char* pCopy = &sInternArena[sInternArenaUsed];
+
+                for (u32 i = 0; i < len; i++) {
+                    char c = pStr[i];
+                    pCopy[i] = c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+                }
+
+                sInternArenaUsed += len;
+                sInternNum++;
+                sInternTable[slot] = pCopy;
+                pHandle = pCopy;
+            }
+        }
+
+        OSRestoreInterrupts(inter);
+        return pHandle;
+    }
+
+    // never adds, nullptr means no handle exists for the name
+    const char* findInternedString(const char *pStr) {
+        return sInternTable[findInternSlot(pStr)];
+    }
+
+    // every handle given out so far is dead afterwards, holders have to intern their names again
+    void clearInternedStrings() {
+        BOOL inter = OSDisableInterrupts();
+
+        for (u32 i = 0; i < cInternTableSize; i++) {
+            sInternTable[i] = nullptr;
+        }
+
+        sInternArenaUsed = 0;
+        sInternNum = 0;
+        OSRestoreInterrupts(inter);
+    }
+
+    u32 getHashCodeLower(const char *pStr) {
+        u32 val;
+        for (val = 0; *pStr != 0; pStr++) {
+            char c = *pStr;
+            if (c >= 'A' && c <= 'Z') {
+                c += 'a' - 'A';
+            }
+
+            val = c + (val * 31);
+        }
+
+        return val;
+    }
+
 };
\ No newline at end of file
@@ -1,24 +1,248 @@
 #include "Game/Util/JMapInfo.hpp"
+#include "Game/Util/HashUtil.hpp"
 #include "Game/Util/StringUtil.hpp"
 #include "JSystem/JGadget/hashcode.hpp"
+#include "JSystem/JKernel/JKRHeap.hpp"
+#include <mem.h>
 
 JMapInfo::JMapInfo() {
     mData = nullptr;
     mName = "Undifined";
+    memset(mItemSlots, 0, sizeof(mItemSlots));
+    mDecodedColumns = nullptr;
+    mDecodedSize = 0;
+    mValueIndexList = nullptr;
+    mValueIndexHeap = nullptr;
 }
 
 JMapInfo::~JMapInfo() {
-
+    destroyDecodedView();
 }
 
+u32 JMapInfo::sDecodedViewTotalSize = 0;
+
 bool JMapInfo::attach(const void* pData) {
     if (pData == nullptr) {
         return false;
     }
     mData = static_cast<const JMapData*>(pData);
+    createItemSlotTable();
+
+    // copies never share the view so it can go, the indices stay in their heap since copies may still point at them
+    destroyDecodedView();
+    mValueIndexList = nullptr;
+    // indices live as long as the data, tables outside of every heap are only scanned
+    mValueIndexHeap = JKRHeap::findFromRoot(const_cast<void*>(pData));
     return true;
 }
 
+// a slot keeps the first item that lands in it, so searches return the same item as a linear scan
+void JMapInfo::createItemSlotTable() {
+    memset(mItemSlots, 0, sizeof(mItemSlots));
+
+    s32 nFields = getNumFields();
+    if (nFields > 0xFF) {
+        nFields = 0xFF;
+    }
+
+    for (int i = 0; i < nFields; ++i) {
+        u8* pSlot = &mItemSlots[mData->mItems[i].mHash & (JMAP_ITEM_SLOT_NUM - 1)];
+
+        if (*pSlot == 0) {
+            *pSlot = i + 1;
+        }
+    }
+}
+
+// expands the integer and string fields into one 32-bit value per entry so reads skip the mask, shift and
+// string table. floats are already read straight from the entry and stay there. returns the size of the view
+// in bytes, 0 when the table is outside of every heap or the heap is full
+u32 JMapInfo::createDecodedView() {
+    if (!dataExists() || mDecodedColumns != nullptr) {
+        return mDecodedSize;
+    }
+
+    if (mValueIndexHeap == nullptr) {
+        return 0;
+    }
+
+    s32 nFields = getNumFields();
+    s32 nEntries = getNumEntries();
+    s32 nDecodedFields = 0;
+
+    for (int i = 0; i < nFields; ++i) {
+        if (mData->mItems[i].mType != JMAP_VALUE_TYPE_NULL && mData->mItems[i].mType != JMAP_VALUE_TYPE_FLOAT) {
+            nDecodedFields++;
+        }
+    }
+
+    u32 columnSize = nFields * sizeof(JMapDecodedColumn);
+    u32 size = columnSize + nDecodedFields * nEntries * sizeof(u32);
+    u8* pBlock = new (mValueIndexHeap, 0) u8[size];
+
+    if (pBlock == nullptr) {
+        return 0;
+    }
+
+    JMapDecodedColumn* pColumns = reinterpret_cast<JMapDecodedColumn*>(pBlock);
+    u32* pValues = reinterpret_cast<u32*>(pBlock + columnSize);
+
+    for (int i = 0; i < nFields; ++i) {
+        const JMapItem* item = &mData->mItems[i];
+        JMapDecodedColumn* pColumn = &pColumns[i];
+        pColumn->mValues = nullptr;
+        pColumn->mIsDecoded = false;
+        pColumn->mIsValidS32 = false;
+
+        switch (item->mType) {
+            case JMAP_VALUE_TYPE_LONG:
+            case JMAP_VALUE_TYPE_LONG_2:
+            case JMAP_VALUE_TYPE_SHORT:
+            case JMAP_VALUE_TYPE_BYTE:
+                pColumn->mIsValidS32 = isValidS32Item(item);
+
+                for (int entry = 0; entry < nEntries; ++entry) {
+                    if (pColumn->mIsValidS32) {
+                        getValueFast(entry, i, reinterpret_cast<s32*>(&pValues[entry]));
+                    }
+                    else {
+                        getValueFast(entry, i, &pValues[entry]);
+                    }
+                }
+                break;
+            case JMAP_VALUE_TYPE_STRING:
+            case JMAP_VALUE_TYPE_STRING_PTR:
+                for (int entry = 0; entry < nEntries; ++entry) {
+                    getValueFast(entry, i, reinterpret_cast<const char**>(&pValues[entry]));
+                }
+                break;
+            default:
+                continue;
+        }
+
+        pColumn->mValues = pValues;
+        pColumn->mIsDecoded = true;
+        pValues += nEntries;
+    }
+
+    mDecodedColumns = pColumns;
+    mDecodedSize = size;
+    sDecodedViewTotalSize += size;
+    return mDecodedSize;
+}
+
+void JMapInfo::destroyDecodedView() {
+    if (mDecodedColumns == nullptr) {
+        return;
+    }
+
+    delete[] reinterpret_cast<u8*>(mDecodedColumns);
+    sDecodedViewTotalSize -= mDecodedSize;
+    mDecodedColumns = nullptr;
+    mDecodedSize = 0;
+}
+
+// bytes taken by every decoded view alive right now
+u32 JMapInfo::getDecodedViewTotalSize() {
+    return sDecodedViewTotalSize;
+}
+
+namespace {
+    inline u32 getValueIndexBucket(const JMapValueIndex* pIndex, u32 key) {
+        return MR::getMixedHashCode(key) & pIndex->mBucketMask;
+    }
+};
+
+bool JMapInfo::calcValueIndexKey(const JMapItem* pItem, const char* value, u32* pKeyOut) {
+    if (pItem->mType != JMAP_VALUE_TYPE_STRING && pItem->mType != JMAP_VALUE_TYPE_STRING_PTR) {
+        return false;
+    }
+
+    *pKeyOut = MR::getHashCodeLower(value);
+    return true;
+}
+
+// built on the first search of a field in the heap holding the data, tables too small to gain from it are still scanned
+const JMapValueIndex* JMapInfo::getValueIndex(int itemIndex) const {
+    s32 nEntries = getNumEntries();
+
+    if (nEntries < JMAP_VALUE_INDEX_ENTRY_MIN || mValueIndexHeap == nullptr) {
+        return nullptr;
+    }
+
+    for (JMapValueIndex* pIndex = mValueIndexList; pIndex != nullptr; pIndex = pIndex->mNext) {
+        if (pIndex->mItemIndex == itemIndex) {
+            return pIndex;
+        }
+    }
+
+    const JMapItem* item = &mData->mItems[itemIndex];
+
+    if (item->mType == JMAP_VALUE_TYPE_NULL) {
+        return nullptr;
+    }
+
+    u32 bucketNum = 1;
+    while (bucketNum < nEntries) {
+        bucketNum <<= 1;
+    }
+
+    u8* pBlock = new (mValueIndexHeap, 0) u8[sizeof(JMapValueIndex) + (bucketNum + nEntries) * sizeof(s32)];
+
+    if (pBlock == nullptr) {
+        return nullptr;
+    }
+
+    JMapValueIndex* pIndex = reinterpret_cast<JMapValueIndex*>(pBlock);
+    pIndex->mItemIndex = itemIndex;
+    pIndex->mBucketMask = bucketNum - 1;
+    pIndex->mBuckets = reinterpret_cast<s32*>(pBlock + sizeof(JMapValueIndex));
+    pIndex->mEntryNext = pIndex->mBuckets + bucketNum;
+
+    for (u32 i = 0; i < bucketNum; i++) {
+        pIndex->mBuckets[i] = -1;
+    }
+
+    // pushed from the back so every chain stays in entry order
+    for (s32 entry = nEntries - 1; entry >= 0; entry--) {
+        u32 key = 0;
+
+        if (isIntegerItem(item)) {
+            u32 value;
+            getValueFast(entry, itemIndex, &value);
+            calcValueIndexKey(item, value, &key);
+        }
+        else if (item->mType == JMAP_VALUE_TYPE_FLOAT) {
+            f32 value;
+            getValueFast(entry, itemIndex, &value);
+            calcValueIndexKey(item, value, &key);
+        }
+        else {
+            const char* value;
+            getValueFast(entry, itemIndex, &value);
+            calcValueIndexKey(item, value, &key);
+        }
+
+        u32 bucket = getValueIndexBucket(pIndex, key);
+        pIndex->mEntryNext[entry] = pIndex->mBuckets[bucket];
+        pIndex->mBuckets[bucket] = entry;
+    }
+
+    pIndex->mNext = mValueIndexList;
+    mValueIndexList = pIndex;
+    return pIndex;
+}
+
+s32 JMapInfo::getFirstIndexedEntry(const JMapValueIndex* pIndex, u32 key, int startIndex) const {
+    s32 entry = pIndex->mBuckets[getValueIndexBucket(pIndex, key)];
+
+    while (entry >= 0 && entry < startIndex) {
+        entry = pIndex->mEntryNext[entry];
+    }
+
+    return entry;
+}
+
 void JMapInfo::setName(const char* pName) {
     mName = pName;
 }
@@ -32,9 +256,27 @@ s32 JMapInfo::searchItemInfo(const char* pKey) const {
         return -1;
     }
 
+    return searchItemInfoByHash(JGadget::getHashCode(pKey));
+}
+
+s32 JMapInfo::searchItemInfoByHash(u32 hash) const {
+    if (!dataExists()) {
+        return -1;
+    }
+
     s32 nFields = getNumFields();
-    u32 hash = JGadget::getHashCode(pKey);
+    s32 slot = mItemSlots[hash & (JMAP_ITEM_SLOT_NUM - 1)];
+
+    if (slot != 0) {
+        if (mData->mItems[slot - 1].mHash == hash) {
+            return slot - 1;
+        }
+    }
+    else if (nFields <= 0xFF) {
+        return -1;
+    }
 
+    // two items share the slot
     for (int i = 0; i < nFields; ++i) {
         if (mData->mItems[i].mHash == hash) {
             return i;
@@ -55,6 +297,13 @@ s32 JMapInfo::getValueType(const char* pItem) const {
 
 bool JMapInfo::getValueFast(int entryIndex, int itemIndex, const char** pValueOut) const {
     const JMapItem* item = &mData->mItems[itemIndex];
+    const JMapDecodedColumn* pColumn = getDecodedColumn(itemIndex);
+
+    if (pColumn != nullptr && (item->mType == JMAP_VALUE_TYPE_STRING || item->mType == JMAP_VALUE_TYPE_STRING_PTR)) {
+        *pValueOut = reinterpret_cast<const char* const*>(pColumn->mValues)[entryIndex];
+        return true;
+    }
+
     const char* valuePtr = getEntryAddress(mData, mData->mDataOffset, entryIndex) + item->mOffsData;
 
     switch (item->mType) {
@@ -72,6 +321,15 @@ bool JMapInfo::getValueFast(int entryIndex, int itemIndex, const char** pValueOu
 
 bool JMapInfo::getValueFast(int entryIndex, int itemIndex, u32* pValueOut) const {
     const JMapItem* item = &mData->mItems[itemIndex];
+    const JMapDecodedColumn* pColumn = getDecodedColumn(itemIndex);
+
+    if (pColumn != nullptr && item->mType != JMAP_VALUE_TYPE_FLOAT && item->mType < JMAP_VALUE_TYPE_STRING_PTR
+        && item->mType != JMAP_VALUE_TYPE_STRING) {
+        u32 value = pColumn->mValues[entryIndex];
+        *pValueOut = pColumn->mIsValidS32 ? value & item->mMask : value;
+        return true;
+    }
+
     const char* valuePtr = getEntryAddress(mData, mData->mDataOffset, entryIndex) + item->mOffsData;
 
     u32 rawValue;
@@ -96,6 +354,17 @@ bool JMapInfo::getValueFast(int entryIndex, int itemIndex, u32* pValueOut) const
 
 bool JMapInfo::getValueFast(int entryIndex, int itemIndex, s32* pValueOut) const {
     const JMapItem* item = &mData->mItems[itemIndex];
+    const JMapDecodedColumn* pColumn = getDecodedColumn(itemIndex);
+
+    if (pColumn != nullptr) {
+        if (!pColumn->mIsValidS32) {
+            return false;
+        }
+
+        *pValueOut = reinterpret_cast<const s32*>(pColumn->mValues)[entryIndex];
+        return true;
+    }
+
     if (item->mShift != 0) {
         goto FAIL;
     }
@@ -131,6 +400,20 @@ FAIL:
 JMapInfoIter MR::findJMapInfoElementNoCase(const JMapInfo* pInfo, const char* key, const char* searchValue, int startIndex) {
     int entryIndex = startIndex;
     const char* value;
+
+    s32 itemIndex = pInfo->searchItemInfo(key);
+    const JMapValueIndex* pIndex = itemIndex >= 0 ? pInfo->getValueIndex(itemIndex) : nullptr;
+    u32 hash;
+    if (pIndex != nullptr && JMapInfo::calcValueIndexKey(&pInfo->mData->mItems[itemIndex], searchValue, &hash)) {
+        for (entryIndex = pInfo->getFirstIndexedEntry(pIndex, hash, startIndex); entryIndex >= 0; entryIndex = pIndex->mEntryNext[entryIndex]) {
+            pInfo->getValueFast(entryIndex, itemIndex, &value);
+            if (MR::isEqualStringCase(value, searchValue)) {
+                return JMapInfoIter(pInfo, entryIndex);
+            }
+        }
+        return pInfo->end();
+    }
+
     while (entryIndex < pInfo->getNumEntries()) {
         pInfo->getValue<const char*>(entryIndex, key, &value);
         if (MR::isEqualStringCase(value, searchValue)) {
@@ -49,6 +49,52 @@ namespace {
         return true;
     } 
 
+    bool getJMapInfoArgNoInit(const JMapInfoIter &rIter, u32 hash, s32 *pOut) NO_INLINE {
+        s32 val;
+        bool hasValue = rIter.getValueByHash<s32>(hash, &val);
+
+        if (!hasValue) {
+            return false;
+        } 
+
+        if (val != -1) {
+            *pOut = val;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool getJMapInfoArgNoInit(const JMapInfoIter &rIter, u32 hash, f32 *pOut) NO_INLINE {
+        s32 val;
+        bool hasValue = ::getJMapInfoArgNoInit(rIter, hash, &val);
+
+        if (!hasValue) {
+            return false;
+        }
+
+        *pOut = val;
+        return true;
+    }
+
+    bool getJMapInfoArgNoInit(const JMapInfoIter &rIter, u32 hash, bool *pOut) NO_INLINE {
+        s32 val;
+        bool hasValue = rIter.getValueByHash<s32>(hash, &val);
+
+        if (!hasValue) {
+            return false;
+        } 
+
+        if (val != -1) {
+            *pOut = true;
+        }
+        else {
+            *pOut = false;
+        }
+
+        return true;
+    }
+
     bool getJMapInfoArgNoInit(const JMapInfoIter &rIter, const char *pName, bool *pOut) NO_INLINE {
         s32 val;
         bool hasValue = rIter.getValue<s32>(pName, &val);
@@ -96,6 +142,21 @@ namespace MR {
         *pOut = false;
         return ::getJMapInfoArgNoInit(rIter, pName, pOut);
     }
+
+    inline bool getArgAndInit(const JMapInfoIter &rIter, u32 hash, s32 *pOut) {
+        *pOut = -1;
+        return ::getJMapInfoArgNoInit(rIter, hash, pOut);
+    }
+
+    inline bool getArgAndInit(const JMapInfoIter &rIter, u32 hash, f32 *pOut) {
+        *pOut = -1.0f;
+        return ::getJMapInfoArgNoInit(rIter, hash, pOut);
+    }
+
+    inline bool getArgAndInit(const JMapInfoIter &rIter, u32 hash, bool *pOut) {
+        *pOut = false;
+        return ::getJMapInfoArgNoInit(rIter, hash, pOut);
+    }
 };
 
 namespace MR {
@@ -165,143 +226,143 @@ namespace MR {
     }
 
     bool getJMapInfoArg0WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return getArgAndInit(rIter, "Obj_arg0", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG0, pOut);
     }
 
     bool getJMapInfoArg0WithInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return getArgAndInit(rIter, "Obj_arg0", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG0, pOut);
     }
 
     bool getJMapInfoArg0WithInit(const JMapInfoIter &rIter, bool *pOut) {
-        return getArgAndInit(rIter, "Obj_arg0", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG0, pOut);
     }
 
     bool getJMapInfoArg1WithInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return getArgAndInit(rIter, "Obj_arg1", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG1, pOut);
     }
 
     bool getJMapInfoArg1WithInit(const JMapInfoIter &rIter, bool *pOut) {
-        return getArgAndInit(rIter, "Obj_arg1", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG1, pOut);
     }
 
     bool getJMapInfoArg2WithInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return getArgAndInit(rIter, "Obj_arg2", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG2, pOut);
     }
 
     bool getJMapInfoArg2WithInit(const JMapInfoIter &rIter, bool *pOut) {
-        return getArgAndInit(rIter, "Obj_arg2", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG2, pOut);
     }
 
     bool getJMapInfoArg3WithInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return getArgAndInit(rIter, "Obj_arg3", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG3, pOut);
     }
 
     bool getJMapInfoArg3WithInit(const JMapInfoIter &rIter, bool *pOut) {
-        return getArgAndInit(rIter, "Obj_arg3", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG3, pOut);
     }
 
     bool getJMapInfoArg4WithInit(const JMapInfoIter &rIter, bool *pOut) {
-        return getArgAndInit(rIter, "Obj_arg4", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG4, pOut);
     }
 
     bool getJMapInfoArg7WithInit(const JMapInfoIter &rIter, bool *pOut) {
-        return getArgAndInit(rIter, "Obj_arg7", pOut);
+        return getArgAndInit(rIter, JMAP_HASH_OBJ_ARG7, pOut);
     }
 
     bool getJMapInfoArg0NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg0", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG0, pOut);
     }
 
     bool getJMapInfoArg0NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg0", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG0, pOut);
     }
 
     bool getJMapInfoArg0NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg0", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG0, pOut);
     }
 
     bool getJMapInfoArg1NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg1", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG1, pOut);
     }
 
     bool getJMapInfoArg1NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg1", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG1, pOut);
     }
 
     bool getJMapInfoArg1NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg1", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG1, pOut);
     }
 
     bool getJMapInfoArg2NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg2", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG2, pOut);
     }
 
     bool getJMapInfoArg2NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg2", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG2, pOut);
     }
 
     bool getJMapInfoArg2NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg2", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG2, pOut);
     }
 
     bool getJMapInfoArg3NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg3", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG3, pOut);
     }
 
     bool getJMapInfoArg3NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg3", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG3, pOut);
     }
 
     bool getJMapInfoArg3NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg3", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG3, pOut);
     }
 
     bool getJMapInfoArg4NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg4", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG4, pOut);
     }
 
     bool getJMapInfoArg4NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg4", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG4, pOut);
     }
 
     bool getJMapInfoArg4NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg4", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG4, pOut);
     }
 
     bool getJMapInfoArg5NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg5", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG5, pOut);
     }
 
     bool getJMapInfoArg5NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg5", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG5, pOut);
     }
 
     bool getJMapInfoArg5NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg5", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG5, pOut);
     }
 
     bool getJMapInfoArg6NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg6", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG6, pOut);
     }
 
     bool getJMapInfoArg6NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg6", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG6, pOut);
     }
 
     bool getJMapInfoArg6NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg6", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG6, pOut);
     }
 
     bool getJMapInfoArg7NoInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg7", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG7, pOut);
     }
 
     bool getJMapInfoArg7NoInit(const JMapInfoIter &rIter, f32 *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg7", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG7, pOut);
     }
 
     bool getJMapInfoArg7NoInit(const JMapInfoIter &rIter, bool *pOut) {
-        return ::getJMapInfoArgNoInit(rIter, "Obj_arg7", pOut);
+        return ::getJMapInfoArgNoInit(rIter, JMAP_HASH_OBJ_ARG7, pOut);
     }
 
     bool isEqualObjectName(const JMapInfoIter &rIter, const char *pOtherName) {
@@ -318,7 +379,7 @@ namespace MR {
 
     s32 getDemoGroupLinkID(const JMapInfoIter &rIter) {
         s32 linkID = -1;
-        rIter.getValue<s32>("l_id", &linkID);
+        rIter.getValueByHash<s32>(JMAP_HASH_L_ID, &linkID);
         return linkID; 
     }
 
@@ -327,7 +388,7 @@ namespace MR {
     }
 
     bool getRailId(const JMapInfoIter &rIter, s32 *pRailID) {
-        return getArgAndInit(rIter, "CommonPath_ID", pRailID); 
+        return getArgAndInit(rIter, JMAP_HASH_COMMON_PATH_ID, pRailID); 
     } 
 
     bool getObjectName(const char **pName, const JMapInfoIter &rIter) {
@@ -339,7 +400,7 @@ namespace MR {
             return true;
         }
 
-        return rIter.getValue<const char*>("name", pName);
+        return rIter.getValueByHash<const char*>(JMAP_HASH_NAME, pName);
     }
 
     bool isExistJMapArg(const JMapInfoIter &rIter) {
@@ -348,7 +409,7 @@ namespace MR {
         }
 
         s32 val;
-        return rIter.getValue<s32>("Obj_arg0", &val);
+        return rIter.getValueByHash<s32>(JMAP_HASH_OBJ_ARG0, &val);
     }
 
     bool getJMapInfoShapeIdWithInit(const JMapInfoIter &rIter, s32 *pShapeID) {
@@ -357,36 +418,36 @@ namespace MR {
 
 
     bool getJMapInfoTransLocal(const JMapInfoIter &rIter, TVec3f *pOut) {
-        if (!MR::getValue<f32>(rIter, "pos_x", &pOut->x)) {
+        if (!rIter.getValueByHash<f32>(JMAP_HASH_POS_X, &pOut->x)) {
             return false;
         }
-        else if (!MR::getValue<f32>(rIter, "pos_y", &pOut->y)) {
+        else if (!rIter.getValueByHash<f32>(JMAP_HASH_POS_Y, &pOut->y)) {
             return false;
         }
 
-        return MR::getValue<f32>(rIter, "pos_z", &pOut->z);
+        return rIter.getValueByHash<f32>(JMAP_HASH_POS_Z, &pOut->z);
     }
 
     bool getJMapInfoRotateLocal(const JMapInfoIter &rIter, TVec3f *pOut) {
-        if (!MR::getValue<f32>(rIter, "dir_x", &pOut->x)) {
+        if (!rIter.getValueByHash<f32>(JMAP_HASH_DIR_X, &pOut->x)) {
             return false;
         }
-        else if (!MR::getValue<f32>(rIter, "dir_y", &pOut->y)) {
+        else if (!rIter.getValueByHash<f32>(JMAP_HASH_DIR_Y, &pOut->y)) {
             return false;
         }
 
-        return MR::getValue<f32>(rIter, "dir_z", &pOut->z);
+        return rIter.getValueByHash<f32>(JMAP_HASH_DIR_Z, &pOut->z);
     }
 
     bool getJMapInfoScale(const JMapInfoIter &rIter, TVec3f *pOut) {
-        if (!MR::getValue<f32>(rIter, "scale_x", &pOut->x)) {
+        if (!rIter.getValueByHash<f32>(JMAP_HASH_SCALE_X, &pOut->x)) {
             return false;
         }
-        else if (!MR::getValue<f32>(rIter, "scale_y", &pOut->y)) {
+        else if (!rIter.getValueByHash<f32>(JMAP_HASH_SCALE_Y, &pOut->y)) {
             return false;
         }
 
-        return MR::getValue<f32>(rIter, "scale_z", &pOut->z);
+        return rIter.getValueByHash<f32>(JMAP_HASH_SCALE_Z, &pOut->z);
     }
 
     bool getJMapInfoV3f(const JMapInfoIter &rIter, const char *pName, TVec3f *pOut) {
@@ -408,31 +469,31 @@ namespace MR {
     }
 
     bool getJMapInfoArg1WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return MR::getArgAndInit(rIter, "Obj_arg1", pOut);
+        return MR::getArgAndInit(rIter, JMAP_HASH_OBJ_ARG1, pOut);
     }
 
     bool getJMapInfoArg2WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return MR::getArgAndInit(rIter, "Obj_arg2", pOut);
+        return MR::getArgAndInit(rIter, JMAP_HASH_OBJ_ARG2, pOut);
     }
 
     bool getJMapInfoArg3WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return MR::getArgAndInit(rIter, "Obj_arg3", pOut);
+        return MR::getArgAndInit(rIter, JMAP_HASH_OBJ_ARG3, pOut);
     }
 
     bool getJMapInfoArg4WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return MR::getArgAndInit(rIter, "Obj_arg4", pOut);
+        return MR::getArgAndInit(rIter, JMAP_HASH_OBJ_ARG4, pOut);
     }
 
     bool getJMapInfoArg5WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return MR::getArgAndInit(rIter, "Obj_arg5", pOut);
+        return MR::getArgAndInit(rIter, JMAP_HASH_OBJ_ARG5, pOut);
     }
 
     bool getJMapInfoArg6WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return MR::getArgAndInit(rIter, "Obj_arg6", pOut);
+        return MR::getArgAndInit(rIter, JMAP_HASH_OBJ_ARG6, pOut);
     }
 
     bool getJMapInfoArg7WithInit(const JMapInfoIter &rIter, s32 *pOut) {
-        return MR::getArgAndInit(rIter, "Obj_arg7", pOut);
+        return MR::getArgAndInit(rIter, JMAP_HASH_OBJ_ARG7, pOut);
     }
 
     bool getJMapInfoFollowID(const JMapInfoIter &rIter, s32 *pOut) {
@@ -456,7 +517,7 @@ namespace MR {
     }
 
     bool getJMapInfoLinkID(const JMapInfoIter &rIter, s32 *pOut) {
-        return rIter.getValue<s32>("l_id", pOut);
+        return rIter.getValueByHash<s32>(JMAP_HASH_L_ID, pOut);
     }
 
     bool isConnectedWithRail(const JMapInfoIter &rIter) {
@@ -465,7 +526,7 @@ namespace MR {
         }
 
         s32 id;
-        return !MR::getArgAndInit(rIter, "CommonPath_ID", &id) ? false : id != -1;
+        return !MR::getArgAndInit(rIter, JMAP_HASH_COMMON_PATH_ID, &id) ? false : id != -1;
     }
 
     bool isExistStageSwitchA(const JMapInfoIter &rIter) {
@@ -474,7 +535,7 @@ namespace MR {
         }
 
         s32 id;
-        MR::getArgAndInit(rIter, "SW_A", &id);
+        MR::getArgAndInit(rIter, JMAP_HASH_SW_A, &id);
         return id != -1;
     }
 
@@ -484,7 +545,7 @@ namespace MR {
         }
 
         s32 id;
-        MR::getArgAndInit(rIter, "SW_B", &id);
+        MR::getArgAndInit(rIter, JMAP_HASH_SW_B, &id);
         return id != -1;
     }
 
@@ -494,7 +555,7 @@ namespace MR {
         }
 
         s32 id;
-        MR::getArgAndInit(rIter, "SW_APPEAR", &id);
+        MR::getArgAndInit(rIter, JMAP_HASH_SW_APPEAR, &id);
         return id != -1;
     }
 
@@ -504,7 +565,7 @@ namespace MR {
         }
 
         s32 id;
-        MR::getArgAndInit(rIter, "SW_DEAD", &id);
+        MR::getArgAndInit(rIter, JMAP_HASH_SW_DEAD, &id);
         return id != -1;
     }
 
@@ -514,7 +575,7 @@ namespace MR {
         }
 
         s32 id;
-        MR::getArgAndInit(rIter, "SW_SLEEP", &id);
+        MR::getArgAndInit(rIter, JMAP_HASH_SW_SLEEP, &id);
         return id != -1;
     }
 
@@ -275,5 +275,8 @@ namespace MR {
         return mult == curStep;
     }
 
-    
+    // the differed buffer is built on the first btk/brk/btp/bpk start instead of right away
+    void requestDifferedDLBuffer(LiveActor *pActor) {
+        pActor->mModelManager->requestDifferedDLBuffer();
+    }
 };
@@ -1,4 +1,5 @@
 #include "JSystem/J3DGraphLoader/J3DModelLoader.hpp"
+#include "JSystem/JKernel/JKRSolidHeap.hpp"
 
 J3DModelLoader::J3DModelLoader() {
     mpModelData = nullptr;
@@ -32,5 +33,88 @@ J3DModelData* J3DModelLoaderDataBase::load(const void *data, u32 flags) {
     return nullptr;
 }
 
+// gives the unused end of a solid heap back to its parent. only the head is trimmed, so this is
+// skipped if anything was allocated from the tail
+static void shrinkSolidHeap(JKRSolidHeap *pHeap, JKRHeap *pParentHeap) {
+    OSLockMutex(&pHeap->mMutex);
+
+    if (pHeap->mSolidTail == pHeap->mEnd) {
+        u32 headerSize = (u32)pHeap->mStart - (u32)pHeap;
+        u32 usedSize = OSRoundUp32B(pHeap->mSolidHead - pHeap->mStart);
+
+        if (pParentHeap->resize(pHeap, headerSize + usedSize) != -1) {
+            pHeap->mFreeSize = 0;
+            pHeap->mSize = usedSize;
+            pHeap->mEnd = pHeap->mStart + usedSize;
+            pHeap->mSolidHead = pHeap->mEnd;
+            pHeap->mSolidTail = pHeap->mEnd;
+        }
+    }
+
+    OSUnlockMutex(&pHeap->mMutex);
+}
+
+// runs the loader with pHeap current, since the loader news everything on the current heap
+static J3DModelData* loadOnHeap(J3DModelLoader *pLoader, const void *data, u32 flags, JKRHeap *pHeap) {
+    JKRHeap* pPrevHeap = pHeap->becomeCurrentHeap();
+    J3DModelData* pModelData = pLoader->load(data, flags);
+    pPrevHeap->becomeCurrentHeap();
+    return pModelData;
+}
+
+// builds the model data inside one solid heap taken from pParentHeap, so every object the loader
+// news is a pointer bump with no block header. the model data is released by destroying *ppHeap,
+// or with pParentHeap. if the heap can't be reserved the model is loaded normally on pParentHeap
+// and *ppHeap is null
+J3DModelData* J3DModelLoaderDataBase::loadSolid(const void *data, u32 flags, JKRHeap *pParentHeap, JKRSolidHeap **ppHeap) {
+    *ppHeap = nullptr;
+
+    if (data == nullptr || *(u32*)data != 'J3D2') {
+        return nullptr;
+    }
+
+    J3DModelLoader_v21 loader_v21;
+    J3DModelLoader_v26 loader_v26;
+    J3DModelLoader* pLoader;
+
+    if (*(u32*)((u32)data + 4) == 'bmd2') {
+        pLoader = &loader_v21;
+    }
+    else if (*(u32*)((u32)data + 4) == 'bmd3') {
+        pLoader = &loader_v26;
+    }
+    else {
+        return nullptr;
+    }
+
+    // calcLoadSize counts the objects but not the padding in front of the 0x20 aligned blocks. those
+    // blocks are whole multiples of 0x20 and their padding is under 0x20, so twice the count is a hard
+    // bound and the load can't run the heap dry. the unused part goes back to the parent below
+    u32 loadSize = OSRoundUp32B(pLoader->calcLoadSize(data, flags));
+    u32 reserveSize = OSRoundUp32B(sizeof(JKRSolidHeap)) + loadSize * 2;
+
+    if (pParentHeap->getMaxAllocatableSize(0x10) < reserveSize) {
+        return loadOnHeap(pLoader, data, flags, pParentHeap);
+    }
+
+    JKRSolidHeap* pHeap = JKRSolidHeap::create(reserveSize, pParentHeap, false);
+
+    if (pHeap == nullptr) {
+        return loadOnHeap(pLoader, data, flags, pParentHeap);
+    }
+
+    J3DModelData* pModelData = loadOnHeap(pLoader, data, flags, pHeap);
+
+    if (pModelData == nullptr) {
+        JKRHeap::destroy(pHeap);
+        return nullptr;
+    }
+
+    shrinkSolidHeap(pHeap, pParentHeap);
+    *ppHeap = pHeap;
+
+    return pModelData;
+}
+
 // J3DModelLoaderDataBase::loadMaterialTable
 // J3DModelLoaderDataBase::loadBinaryDisplayList